@@ -14,6 +14,8 @@
 #include "atdebug.h"
 #include "atstringutils.h"
 #include "atconstants.h"
+#include "atmatcher.h"
+#include "aturcqueue.h"
 #include "crcxmodem.h"
 #if defined(__AVR__)
 #include <pgmspace.h>
@@ -22,28 +24,227 @@
 namespace at {
 
 /**
- * @brief A class for managing client AT command responses
+ * @brief Completion callback for an asynchronous command
  * 
+ * @param error The error code (AT_OK = 0)
+ * @param response The cleaned response, valid until the next command
  */
-class AtClient {
+typedef void (*at_response_cb_t)(at_error_t error, const char* response);
+
+/**
+ * @brief Waits for serial data or a deadline, instead of spinning on
+ * `millis()`. May return early, e.g. when data arrives; callers re-check.
+ * 
+ * @param max_ms The time remaining until the deadline
+ * @param context The context registered with `setWaitFunction`
+ */
+typedef void (*at_wait_fn_t)(uint32_t max_ms, void* context);
+
+/**
+ * @brief Wait function sleeping 1 ms per call (`vTaskDelay` on ESP32).
+ * The default, using ~0% CPU while waiting for a slow modem.
+ */
+void waitDelay(uint32_t max_ms, void* context);
+
+/**
+ * @brief Wait function that only yields, for the lowest latency
+ */
+void waitYield(uint32_t max_ms, void* context);
+
+/**
+ * @brief Receives raw bytes of a binary payload as they arrive
+ * 
+ * @param data The next bytes, valid only for the duration of the call
+ * @param len The number of bytes
+ * @param context The caller's context pointer
+ */
+typedef void (*at_data_sink_t)(const uint8_t* data, size_t len, void* context);
+
+/**
+ * @brief Receives each response line while parsing continues, for responses
+ * larger than the Rx buffer
+ * 
+ * @param line The line without its terminator (not null-terminated), valid
+ * only for the duration of the call
+ * @param len The length of the line
+ * @param complete false if the line exceeds the Rx buffer, in which case the
+ * remainder follows in further calls
+ * @param context The caller's context pointer
+ */
+typedef void (*at_line_cb_t)(const char* line, size_t len, bool complete,
+                             void* context);
+
+/**
+ * @brief Handler for a registered unsolicited result code
+ * 
+ * @param urc The cleaned URC line e.g. `+CREG: 1`
+ * @param params The remainder after the registered prefix and any spaces
+ * Both are valid only for the duration of the call.
+ */
+typedef void (*at_urc_cb_t)(const char* urc, const char* params);
+
+/**
+ * @brief A result code registered in addition to the built-in OK/ERROR
+ */
+struct AtResultCode {
+  char pattern[AT_RESULT_CODE_SIZE];
+  at_error_t error;
+  uint8_t kind;
+};
+
+/**
+ * @brief Storage for the result code and URC matchers, URC handlers and URC
+ * queue, owned by the class deriving from `AtClientBase` alongside its
+ * buffers. Null URC storage with a zero count disables the feature.
+ */
+struct AtClientTables {
+  AtMatcherBase::Node* result_nodes;
+  uint16_t result_node_count;
+  AtMatcherBase::Pattern* result_patterns;   // built-ins + result_code_count
+  AtResultCode* result_codes;
+  uint8_t result_code_count;
+  AtMatcherBase::Node* urc_nodes;
+  uint16_t urc_node_count;
+  AtMatcherBase::Pattern* urc_patterns;
+  at_urc_cb_t* urc_handlers;
+  uint8_t urc_handler_count;
+  char* urc_slots;   // urc_slot_count slots of AT_CLIENT_URC_SLOT_SIZE chars
+  uint8_t urc_slot_count;
+};
+
+/**
+ * @brief Fixed storage sized by a template parameter, empty when the size is
+ * 0 so an unused feature costs no RAM
+ */
+template <typename T, size_t N>
+struct AtArray {
+  T data[N];
+  T* ptr() { return data; }
+};
+
+template <typename T>
+struct AtArray<T, 0> {
+  T* ptr() { return nullptr; }
+};
+
+/**
+ * @brief A zero-copy view of a parsed response in the client's Rx buffer.
+ * Excludes the echo, result code and CRC, and leading/trailing whitespace.
+ * Valid until the next command or URC is parsed by the client.
+ */
+class AtResponseView {
   private:
-#if defined(__AVR__)
-    char at_rx_buffer_P[AT_CLIENT_RX_BUFFERSIZE];
-    char at_tx_buffer_P[AT_CLIENT_TX_BUFFERSIZE];
-#else
-    char at_rx_buffer[AT_CLIENT_RX_BUFFERSIZE];
-    char at_tx_buffer[AT_CLIENT_TX_BUFFERSIZE];
-#endif // progmem
+    const char* payload_data = "";
+    size_t payload_len = 0;
+    const char* prefix = nullptr;
+    size_t prefix_len = 0;
+    size_t line_pos = 0;
+  
+  public:
+    AtResponseView() {};
+    AtResponseView(const char* data, size_t length,
+                   const char* prefix = nullptr);
+
+    /**
+     * @brief Get the whole payload, multiple lines separated by `<cr><lf>`
+     */
+    AtSpan payload() const { return AtSpan{ payload_data, payload_len }; }
+
+    /**
+     * @brief Check if the response has no payload
+     */
+    bool empty() const { return payload_len == 0; }
+
+    /**
+     * @brief Get the next non-blank line with the prefix (and any following
+     * spaces) removed if present
+     * 
+     * @param line Set to the line, excluding line terminators
+     * @return false if there are no more lines
+     */
+    bool nextLine(AtSpan& line);
+
+    /**
+     * @brief Restart line iteration from the first line
+     */
+    void rewind() { line_pos = 0; }
+};
+
+/**
+ * @brief A class for managing client AT command responses.
+ * Holds all the parsing logic over Rx/Tx buffers supplied by a derived
+ * class, so the logic is compiled once whatever the buffer sizes.
+ * Use `AtClient` or `AtClientSized` to construct one.
+ * 
+ */
+class AtClientBase {
+  friend class AtCommandQueue;
+
+  private:
+    char* const at_rx_buffer;
+    char* const at_tx_buffer;
+    size_t rx_len = 0;   // bytes in the Rx buffer excluding terminating null
+    bool rx_clean = false;   // result code/CRC already removed by cleanResponse
+    size_t result_offset = 0;   // start of the final result code if received
+    char rx_chunk[AT_CLIENT_RX_CHUNKSIZE];   // read-ahead drained from serial
+    size_t chunk_pos = 0;
+    size_t chunk_len = 0;
+    AtMatcherBase matcher;
+    AtResultCode* const result_codes;
+    uint8_t result_code_count = 0;
+    AtMatcherBase urc_matcher;
+    at_urc_cb_t* const urc_handlers;
+    uint8_t urc_handler_count = 0;
+    AtUrcQueue urc_queue;
+    size_t line_start = 0;   // start of the line being received in Rx buffer
+    bool queueUrc(const char* line, size_t len);
+    uint8_t info_match = AT_MATCH_NONE;   // result completing at end of line
+    size_t info_offset = 0;   // start of the result information in Rx buffer
     bool response_ready = false;
     bool cmd_result_ok = false;
     bool cmd_crc_found = false;
     at_error_t cmd_error = AT_OK;
     bool debug_raw = false;
     bool isRxBufferFull();
-    bool setPendingCommand(const char* at_command);
+    size_t rxMatchOffset();
+    bool rxStartsWith(const char* prefix);
+    bool rxEndsWith(const char* suffix);
+    bool cmd_pending = false;
+    uint32_t cmd_deadline = 0;   // millis() at which the command times out
+    at_wait_fn_t wait_fn = waitDelay;
+    void* wait_context = nullptr;
+    bool waitForRx(uint32_t deadline);
+    uint32_t idle_us = idleMicros(AT_BAUDRATE);
+    uint32_t last_rx_us = 0;   // micros() when data was last parsed
+    uint8_t idle_match = AT_MATCH_NONE;   // result final if the line goes idle
+    const char* data_header = nullptr;   // line preceding a binary payload
+    uint8_t data_param = 0;   // header parameter holding the payload length
+    uint8_t* data_buffer = nullptr;
+    size_t data_size = 0;
+    at_data_sink_t data_sink = nullptr;
+    void* data_context = nullptr;
+    size_t data_received = 0;
+    at_line_cb_t line_sink = nullptr;
+    void* line_context = nullptr;
+    void sinkLine(bool complete);
+    void readPayload(const char* header_line);
+    at_error_t sendDataCommand(const char* at_command, uint16_t timeout_ms);
+    size_t idle_end = 0;   // Rx length when idle_match was found
+    bool lineIdle();
+    at_response_cb_t cmd_callback = nullptr;
+    const char* pending_cmd;   // the caller's command or its copy in Tx buffer
+    bool tx_flush = true;
+    size_t echo_skipped = 0;   // bytes discarded ahead of the echo
+    bool echo_missed = false;   // echo still awaited when the result arrived
+    bool setPendingCommand(const char* at_command, bool copy);
+    bool transmitCommand(const char* at_command, bool copy, bool flush);
+    void startResponse(uint32_t timeout_ms);
+    bool parseResponse();
+    at_error_t finishResponse();
     parse_state_t parsingOk();
     parse_state_t parsingError();
-    parse_state_t parsingShort(uint8_t current);
+    parse_state_t parsingShort(bool ok);
+    parse_state_t parsingResult(const AtResultCode& code);
     void cleanResponse(const char* prefix = nullptr);
     
   protected:
@@ -66,16 +267,76 @@ class AtClient {
      * @brief Construct a new At Command Buffer object
      * 
      * @param serial The Stream reference associated with the serial port
+     * @param rx_buffer The response buffer, owned by the derived class
+     * @param rx_size The size of the response buffer
+     * @param tx_buffer The command buffer, owned by the derived class
+     * @param tx_size The size of the command buffer
+     * @param tables The matcher and URC storage, owned by the derived class
      */
-    AtClient(Stream &serial) : serial(serial) {
+    AtClientBase(Stream &serial, char* rx_buffer, size_t rx_size,
+                 char* tx_buffer, size_t tx_size, const AtClientTables& tables)
+        : at_rx_buffer(rx_buffer), at_tx_buffer(tx_buffer),
+          matcher(tables.result_nodes, tables.result_node_count,
+                  tables.result_patterns,
+                  AT_MATCHER_BUILTIN_PATTERNS + tables.result_code_count),
+          result_codes(tables.result_codes),
+          urc_matcher(tables.urc_nodes, tables.urc_node_count,
+                      tables.urc_patterns, tables.urc_handler_count),
+          urc_handlers(tables.urc_handlers),
+          urc_queue(tables.urc_slots, tables.urc_slot_count,
+                    AT_CLIENT_URC_SLOT_SIZE),
+          pending_cmd(tx_buffer), serial(serial), rx_buffer_size(rx_size),
+          tx_buffer_size(tx_size) {
       snprintf(terminator, 3, "%c%c", AT_CR, AT_LF);
       snprintf(vres_ok, 8, "%c%cOK%c%c", AT_CR, AT_LF, AT_CR, AT_LF);
       snprintf(vres_err, 16, "%c%cERROR%c%c", AT_CR, AT_LF, AT_CR, AT_LF);
       snprintf(cme_err, 16, "%c%c+CME ERROR:", AT_CR, AT_LF);
       snprintf(res_ok, 3, "0%c", AT_CR);
       snprintf(res_err, 3, "4%c", AT_CR);
+      clearResultCodes();
     };
     
+    /**
+     * @brief Set how the client waits while no serial data is available,
+     * e.g. a condition variable or `poll()` on the serial file descriptor
+     * 
+     * @param wait The wait function (nullptr restores `waitDelay`)
+     * @param context Passed to the wait function
+     */
+    void setWaitFunction(at_wait_fn_t wait, void* context = nullptr);
+
+    /**
+     * @brief Set whether `sendAtCommand` waits for the command to be sent
+     * (`Stream::flush`) before parsing the response. Default on for
+     * half-duplex transports; turn off where the response may be read while
+     * the command is still being sent.
+     * 
+     * @param flush true to wait for transmission to complete
+     */
+    void setTxFlush(bool flush) { tx_flush = flush; }
+
+    /**
+     * @brief Get the inter-character idle time marking the end of a line
+     * (t3.5 as Modbus RTU: 3.5 characters of 11 bits, 1750 us above 19200)
+     * 
+     * @param baud The serial baud rate
+     * @return The idle time in microseconds
+     */
+    static uint32_t idleMicros(uint32_t baud);
+
+    /**
+     * @brief Set the idle timeout used to finish V0 short result codes, and
+     * to conclude no CRC follows an error, from the serial baud rate
+     */
+    void setBaudRate(uint32_t baud);
+
+    /**
+     * @brief Set the idle timeout directly e.g. for USB or TCP transports
+     * 
+     * @param idle_us The inter-character idle time in microseconds
+     */
+    void setIdleTimeout(uint32_t idle_us);
+
     /**
      * @brief Remove previous data from the serial receive buffer
      */
@@ -87,10 +348,11 @@ class AtClient {
     void clearPendingCommand();
     
     /**
-     * @brief Send an AT command on the serial port
+     * @brief Send an AT command on the serial port and wait for the response
      * 
      * @param at_command The AT command to send
-     * @param timeout The timeout in milliseconds (default 1 second)
+     * @param timeout The timeout in milliseconds (default 1 second).
+     * 0 returns `AT_PENDING` immediately, complete the command with `poll`.
      * @return An error code (AT_OK = 0)
      */
     at_error_t sendAtCommand(const char* at_command,
@@ -98,6 +360,101 @@ class AtClient {
     at_error_t sendAtCommand(const String& at_command,
                              uint16_t timeout_ms = AT_TIMEOUT_MS);
 
+    /**
+     * @brief Send an AT command whose response carries a binary payload
+     * following an information line, e.g. `+QIRD: <len><cr><lf><data>`.
+     * The payload bypasses the text parser, so may contain any bytes.
+     * Bytes beyond `data_size` are discarded (data_len reports the total).
+     * 
+     * @param at_command The AT command to send
+     * @param header The information line prefix e.g. `+QIRD:`
+     * @param data The buffer to receive the payload
+     * @param data_size The size of the buffer
+     * @param data_len Set to the payload length received
+     * @param timeout_ms The timeout for the complete response
+     * @param length_param The header parameter holding the payload length
+     * @return An error code (AT_OK = 0)
+     */
+    at_error_t sendAtCommandData(const char* at_command, const char* header,
+                                 uint8_t* data, size_t data_size,
+                                 size_t& data_len,
+                                 uint16_t timeout_ms = AT_TIMEOUT_MS,
+                                 uint8_t length_param = 0);
+
+    /**
+     * @brief As above, streaming the payload to a sink as it arrives
+     */
+    at_error_t sendAtCommandData(const char* at_command, const char* header,
+                                 at_data_sink_t sink, void* context,
+                                 size_t& data_len,
+                                 uint16_t timeout_ms = AT_TIMEOUT_MS,
+                                 uint8_t length_param = 0);
+
+    /**
+     * @brief Send an AT command handing each response line to a callback as
+     * it completes, rather than accumulating it in the Rx buffer, so
+     * responses of any size flow through the fixed buffer.
+     * The final result code is parsed as usual and not passed to the sink.
+     * 
+     * @param at_command The AT command to send
+     * @param sink The function called with each line
+     * @param context Passed to the sink
+     * @param timeout_ms The timeout for the complete response
+     * @return An error code (AT_OK = 0)
+     */
+    at_error_t sendAtCommandLines(const char* at_command, at_line_cb_t sink,
+                                  void* context = nullptr,
+                                  uint16_t timeout_ms = AT_TIMEOUT_MS);
+
+    /**
+     * @brief Read exactly `length` raw bytes, bypassing the text parser
+     * e.g. after a `CONNECT` into transparent mode
+     * 
+     * @param data The buffer to receive the bytes (at least `length`)
+     * @param length The number of bytes to read
+     * @param timeout_ms The maximum time to wait for all bytes
+     * @return The number of bytes read (less than `length` on timeout)
+     */
+    size_t readData(uint8_t* data, size_t length,
+                    uint32_t timeout_ms = AT_TIMEOUT_MS);
+    size_t readData(at_data_sink_t sink, void* context, size_t length,
+                    uint32_t timeout_ms = AT_TIMEOUT_MS);
+
+    /**
+     * @brief Write raw bytes directly from the caller's buffer
+     * e.g. after a `>` prompt registered with `addResultCode`
+     * 
+     * @return The number of bytes written
+     */
+    size_t writeData(const uint8_t* data, size_t length);
+
+    /**
+     * @brief Send an AT command without waiting for the response.
+     * Complete it by calling `poll` (e.g. from `loop()`).
+     * 
+     * @param at_command The AT command to send
+     * @param timeout_ms The timeout in milliseconds (default 1 second)
+     * @param callback Optional function called by `poll` on completion
+     * @return false if a command is already pending or could not be sent
+     */
+    bool submitAtCommand(const char* at_command,
+                         uint32_t timeout_ms = AT_TIMEOUT_MS,
+                         at_response_cb_t callback = nullptr);
+
+    /**
+     * @brief Advance parsing of a pending command using the data available,
+     * without blocking.
+     * 
+     * @return `AT_PENDING` while incomplete, otherwise the command's error code
+     * (also returned when no command is pending)
+     */
+    at_error_t poll();
+
+    /**
+     * @brief Check if a command is awaiting its response
+     */
+    bool commandPending() { return cmd_pending; }
+
     /**
      * @brief Put the AT command response into a string
      * 
@@ -111,6 +468,35 @@ class AtClient {
                      bool clean = true);
     String sgetResponse(const char* prefix = nullptr, bool clean = true);
 
+    /**
+     * @brief Get a view of the response in place, without copying or
+     * modifying the Rx buffer. Valid until the next command or URC.
+     * 
+     * @param prefix Optional prefix to remove from each line
+     * @return The view (empty if no response is ready)
+     */
+    AtResponseView responseView(const char* prefix = nullptr);
+
+    /**
+     * @brief Register an additional result code that ends a command.
+     * The pattern is matched literally, include any `<cr><lf>` framing
+     * e.g. `"\r\nNO CARRIER\r\n"`, `"+CMS ERROR:"` or `"\r\n> "`.
+     * 
+     * @param pattern The result code text (copied)
+     * @param error The error code reported when it is received (AT_OK = 0)
+     * @param kind AT_RESULT_FINAL completes when matched, AT_RESULT_LINE
+     * completes at the end of the line leaving it in the response,
+     * AT_RESULT_PROMPT completes an intermediate prompt awaiting data
+     * @return false if the pattern is too long or too many are registered
+     */
+    bool addResultCode(const char* pattern, at_error_t error = AT_ERROR,
+                       uint8_t kind = AT_RESULT_FINAL);
+
+    /**
+     * @brief Remove all registered result codes, keeping the built-in ones
+     */
+    void clearResultCodes();
+
     /**
      * @brief Check the serial line for unsolicited data with designated prefix.
      * Allows the prefix character to be specified, a time to wait for data,
@@ -120,6 +506,7 @@ class AtClient {
      * @param read_until The line terminator (uses <cr><lf> if none specified)
      * @param timeout_ms Maximum time to wait for terminator in milliseconds if data is present (default 250)
      * @param prefix The character designating unsolicited output (default `+`)
+     * or `\0` for any non-whitespace character
      * @param wait_ms Optional time to wait for data to be present
      * @return false if criteria are not met within wait_ms + timeout
      * @return true if unsolicited data found
@@ -129,11 +516,73 @@ class AtClient {
                   const char prefix = '+',
                   uint16_t wait_ms = 0);
 
+    /**
+     * @brief Register a handler for URCs starting with a prefix.
+     * The longest registered prefix matching a URC is dispatched.
+     * 
+     * @param prefix The URC prefix e.g. `+CREG:` or `RING` (referenced, not
+     * copied, so typically a string literal)
+     * @param handler The function called with the URC
+     * @return false if the prefix is empty or capacity is exceeded
+     */
+    bool addUrcHandler(const char* prefix, at_urc_cb_t handler);
+
+    /**
+     * @brief Remove all registered URC handlers
+     */
+    void clearUrcHandlers();
+
+    /**
+     * @brief Check for a URC (with any prefix) and dispatch it to the
+     * registered handler in a single pass over the line.
+     * URCs queued during prior commands are dispatched first.
+     * A URC with no registered handler is left for `getResponse`.
+     * 
+     * @param timeout_ms Maximum time to wait for the terminator
+     * @param wait_ms Optional time to wait for data to be present
+     * @return true if a URC was received (check `responseReady` for unhandled)
+     */
+    bool dispatchUrc(uint32_t timeout_ms = AT_URC_TIMEOUT_MS,
+                     uint16_t wait_ms = 0);
+
+    /**
+     * @brief Get the number of registered URCs received during commands and
+     * queued rather than discarded
+     */
+    size_t urcsQueued() { return urc_queue.size(); }
+
+    /**
+     * @brief Get the number of queued URCs dropped because the queue was full
+     */
+    uint16_t urcsDropped() { return urc_queue.dropped(); }
+
+    /**
+     * @brief Remove the oldest queued URC
+     * 
+     * @param urc The buffer to copy the URC into
+     * @param buffer_size The size of the buffer
+     * @return false if no URC is queued
+     */
+    bool getQueuedUrc(char* urc, size_t buffer_size);
+
     /**
      * @brief Check if the response or URC is ready for retrieval
     */
     bool responseReady() { return response_ready; }
 
+    /**
+     * @brief Get the number of bytes received ahead of the echo of the last
+     * command and discarded, e.g. line noise or unhandled unsolicited data
+    */
+    size_t echoSkipped() { return echo_skipped; }
+
+    /**
+     * @brief Check if the last command completed without its echo being
+     * received (a corrupted echo, or echo disabled on the modem but not
+     * the client)
+    */
+    bool echoMissed() { return echo_missed; }
+
     /**
      * @brief Check if the modem is busy processing a prior request/data
     */
@@ -147,22 +596,92 @@ class AtClient {
 
   protected:
     Stream& serial;
-    const size_t rx_buffer_size = AT_CLIENT_RX_BUFFERSIZE;
-    const size_t tx_buffer_size = AT_CLIENT_TX_BUFFERSIZE;
+    const size_t rx_buffer_size;
+    const size_t tx_buffer_size;
     // bool busy = false;
     uint8_t cmd_parsing = 0;
     bool data_mode = false;
     bool data_mode_echo = false;
+    size_t rxAvailable();
+    int rxPeek();
     bool readSerialChar(bool ignore_unprintable = false);
+    size_t readSerialText();
+    bool readSerialMatch(uint8_t& match);
     char lastCharRead(size_t n = 1);
     void toggleRaw(bool raw);
-    char* commandPtr();
+    const char* commandPtr();
     char* responsePtr();
     String sDbgReq() { return at::debugString(commandPtr()); }
     String sDbgRes() { return at::debugString(responsePtr()); }
 
 };
 
+/**
+ * @brief An AT client with its buffers and tables sized at compile time, so
+ * several modems in one build can each be given only the memory they need.
+ * `sizeof` an instance is its full static footprint (see
+ * `AT_ASSERT_FOOTPRINT`), of which `AtClientBase` is the fixed part.
+ * 
+ * @tparam RxSize The response buffer size, bounding the largest response
+ * retained for `getResponse` (see `sendAtCommandLines` for larger ones)
+ * @tparam TxSize The command buffer size, bounding the longest command
+ * @tparam UrcHandlers The maximum URC handlers (0 disables `addUrcHandler`)
+ * @tparam UrcSlots The URCs queued during commands (0 drops them)
+ * @tparam ResultCodes The maximum result codes added with `addResultCode`
+ */
+template <size_t RxSize = AT_CLIENT_RX_BUFFERSIZE,
+          size_t TxSize = AT_CLIENT_TX_BUFFERSIZE,
+          uint8_t UrcHandlers = AT_CLIENT_URC_HANDLERS,
+          uint8_t UrcSlots = AT_CLIENT_URC_SLOTS,
+          uint8_t ResultCodes = AT_CLIENT_RESULT_CODES>
+class AtClientSized : public AtClientBase {
+  static_assert(RxSize >= AT_RESULT_CODE_SIZE,
+                "Rx buffer must hold at least a result code");
+  static_assert(TxSize >= 8, "Tx buffer must hold at least a short command");
+  static_assert(AT_MATCH_USER + ResultCodes <= 255,
+                "Too many result codes for the matcher tags");
+
+  private:
+    static const uint16_t ResultNodes = AT_MATCHER_BUILTIN_NODES +
+        ResultCodes * AT_CLIENT_RESULT_CODE_NODES;
+    static const uint16_t UrcNodes = UrcHandlers > 0 ?
+        UrcHandlers * AT_CLIENT_URC_PREFIX_NODES + 1 : 0;
+    char rx_storage[RxSize];
+    char tx_storage[TxSize];
+    AtMatcherBase::Node result_node_storage[ResultNodes];
+    AtMatcherBase::Pattern result_pattern_storage[
+        AT_MATCHER_BUILTIN_PATTERNS + ResultCodes];
+    AtArray<AtResultCode, ResultCodes> result_code_storage;
+    AtArray<AtMatcherBase::Node, UrcNodes> urc_node_storage;
+    AtArray<AtMatcherBase::Pattern, UrcHandlers> urc_pattern_storage;
+    AtArray<at_urc_cb_t, UrcHandlers> urc_handler_storage;
+    AtArray<char, UrcSlots * AT_CLIENT_URC_SLOT_SIZE> urc_slot_storage;
+
+  public:
+    /**
+     * @brief Construct a new At Command Buffer object
+     * 
+     * @param serial The Stream reference associated with the serial port
+     */
+    AtClientSized(Stream &serial)
+        : AtClientBase(serial, rx_storage, RxSize, tx_storage, TxSize,
+                       { result_node_storage, ResultNodes,
+                         result_pattern_storage, result_code_storage.ptr(),
+                         ResultCodes, urc_node_storage.ptr(), UrcNodes,
+                         urc_pattern_storage.ptr(), urc_handler_storage.ptr(),
+                         UrcHandlers, urc_slot_storage.ptr(), UrcSlots }) {
+      rx_storage[0] = '\0';
+      tx_storage[0] = '\0';
+    }
+};
+
+/**
+ * @brief The AT client with the default (`AT_CLIENT_RX_BUFFERSIZE` /
+ * `AT_CLIENT_TX_BUFFERSIZE`) buffers, `AT_CLIENT_URC_*` tables and
+ * `AT_CLIENT_RESULT_CODES`
+ */
+typedef AtClientSized<> AtClient;
+
 }   // namespace at
 
 #endif   // AT_CLIENT_H
\ No newline at end of file
@@ -0,0 +1,134 @@
+/**
+ * @file atclientworker.h
+ * @brief Thread-safe access to a shared AtClient through a dedicated I/O
+ * worker thread
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ */
+#ifndef AT_CLIENT_WORKER_H
+#define AT_CLIENT_WORKER_H
+
+#if !defined(__AVR__)
+
+#include <Arduino.h>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <thread>
+#include "atdebug.h"
+#include "atconstants.h"
+#include "atclient.h"
+
+namespace at {
+
+/**
+ * @brief The outcome of a command run by the worker
+ */
+struct AtResult {
+  at_error_t error;
+  String response;   // cleaned response if error is AT_OK
+};
+
+/**
+ * @brief Completion handler for a command run by the worker.
+ * Called on the worker thread.
+ * 
+ * @param result The error code and response
+ * @param context The caller's context pointer
+ */
+typedef void (*at_worker_cb_t)(const AtResult& result, void* context);
+
+/**
+ * @brief Owns an AtClient and its Stream on a single I/O thread, serialising
+ * commands from any number of producer threads through a bounded queue.
+ * While idle the worker dispatches URCs, so URC handlers run on the worker.
+ * Once started, the AtClient must only be used via the worker.
+ */
+class AtClientWorker {
+  private:
+    struct Request {
+      String command;
+      String prefix;
+      uint32_t timeout_ms;
+      std::promise<AtResult> promise;
+      at_worker_cb_t callback;
+      void* context;
+    };
+    AtClientBase& client;
+    size_t max_queue;
+    uint32_t idle_ms;
+    std::deque<Request> requests;
+    std::mutex lock;
+    std::condition_variable request_ready;   // signals the worker
+    std::condition_variable space_ready;   // signals blocked producers
+    std::thread worker;
+    bool running = false;
+    void run();
+    bool onWorker();
+    bool enqueue(Request&& request);
+
+  public:
+    /**
+     * @param client The client to own
+     * @param max_queue Maximum queued commands before producers block
+     * @param idle_ms Interval to check for URCs when no command is queued
+     */
+    AtClientWorker(AtClientBase& client, size_t max_queue = 16,
+                   uint32_t idle_ms = 10);
+    ~AtClientWorker();
+
+    /**
+     * @brief Start the worker thread
+     */
+    void start();
+
+    /**
+     * @brief Complete queued commands and stop the worker thread
+     */
+    void stop();
+
+    /**
+     * @brief Queue a command, blocking while the queue is full.
+     * From a worker callback or URC handler a full queue rejects the command
+     * rather than blocking.
+     * 
+     * @param at_command The AT command (copied)
+     * @param timeout_ms The response timeout (0 uses `AT_TIMEOUT_MS`)
+     * @param prefix Optional prefix to remove from the response
+     * @return A future for the result
+     */
+    std::future<AtResult> submit(const char* at_command,
+                                 uint32_t timeout_ms = AT_TIMEOUT_MS,
+                                 const char* prefix = nullptr);
+
+    /**
+     * @brief Queue a command with a completion callback
+     * 
+     * @return false if the worker is not running
+     */
+    bool submit(const char* at_command, at_worker_cb_t callback,
+                void* context = nullptr, uint32_t timeout_ms = AT_TIMEOUT_MS,
+                const char* prefix = nullptr);
+
+    /**
+     * @brief Queue a command and wait for its result.
+     * Returns `AT_ERR_BUSY` if called from a worker callback or URC handler,
+     * which run on the worker thread and cannot wait for it; use `submit`.
+     */
+    AtResult sendAtCommand(const char* at_command,
+                           uint32_t timeout_ms = AT_TIMEOUT_MS,
+                           const char* prefix = nullptr);
+
+    /**
+     * @brief Get the number of commands waiting for the worker
+     */
+    size_t queued();
+};
+
+}   // namespace at
+
+#endif   // __AVR__
+
+#endif   // AT_CLIENT_WORKER_H
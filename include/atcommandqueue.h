@@ -0,0 +1,106 @@
+/**
+ * @file atcommandqueue.h
+ * @brief Pipelined submission of a batch of AT commands via AtClient
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ */
+#ifndef AT_COMMAND_QUEUE_H
+#define AT_COMMAND_QUEUE_H
+
+#include <Arduino.h>
+#include "atdebug.h"
+#include "atconstants.h"
+#include "atclient.h"
+
+namespace at {
+
+/**
+ * @brief Per-command completion handler for a queued command
+ * 
+ * @param index The position of the command within its batch
+ * @param error The error code (AT_OK = 0)
+ * @param response The cleaned response, valid until the next command
+ */
+typedef void (*at_queue_cb_t)(size_t index, at_error_t error,
+                              const char* response);
+
+/**
+ * @brief A command within a batch submitted to an AtCommandQueue
+ */
+struct AtQueuedCommand {
+  const char* command;   // must remain valid until the batch completes
+  uint32_t timeout_ms;
+  at_queue_cb_t handler;   // optional
+  at_error_t error;   // result, AT_PENDING until the command completes
+};
+
+/**
+ * @brief Runs a batch of commands in order, sending each as soon as the
+ * prior final result code has been parsed
+ */
+class AtCommandQueue {
+  private:
+    AtClientBase& client;
+    AtQueuedCommand* batch = nullptr;
+    size_t batch_size = 0;
+    size_t next = 0;   // index of the command in flight or next to send
+    bool stop_on_error = false;
+    at_error_t result = AT_OK;
+    bool sendNext();
+  
+  public:
+    /**
+     * @brief Construct a command queue for a client
+     * 
+     * @param client The AtClient the commands are sent through
+     */
+    AtCommandQueue(AtClientBase& client) : client(client) {};
+
+    /**
+     * @brief Start a batch of commands. The first is sent immediately.
+     * 
+     * @param commands The batch (caller-owned), results are stored in place
+     * @param count The number of commands in the batch
+     * @param stop_on_error Set to abandon the remaining commands on an error
+     * @return false if a batch or command is already in progress
+     */
+    bool submit(AtQueuedCommand* commands, size_t count,
+                bool stop_on_error = false);
+
+    /**
+     * @brief Advance the batch without blocking, sending subsequent commands
+     * as soon as each completes.
+     * 
+     * @return `AT_PENDING` while commands remain, else `AT_OK` if all
+     * succeeded or the first error code
+     */
+    at_error_t poll();
+
+    /**
+     * @brief Run the batch to completion (blocking)
+     * 
+     * @return `AT_OK` if all succeeded or the first error code
+     */
+    at_error_t run();
+
+    /**
+     * @brief Abandon the remaining commands of the batch.
+     * A command already sent is still parsed by the client's `poll`.
+     */
+    void cancel();
+
+    /**
+     * @brief Check if a batch is in progress
+     */
+    bool busy() { return batch != nullptr; }
+
+    /**
+     * @brief Get the number of commands completed in the current/last batch
+     */
+    size_t completed() { return next; }
+};
+
+}   // namespace at
+
+#endif   // AT_COMMAND_QUEUE_H
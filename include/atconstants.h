@@ -5,6 +5,8 @@
 #define AT_BAUDRATE 9600
 #endif
 #define AT_CHAR_DELAY_MS 10   // default inter-character milliseconds
+#define AT_IDLE_CHARS_X10 35   // idle characters ending a line (t3.5) x10
+#define AT_IDLE_MIN_US 1750   // idle time floor for fast links (Modbus RTU)
 #define AT_TIMEOUT_MS 1000   // default timeout for command responses
 #define AT_URC_TIMEOUT_MS 250   // default timeout checking for unsolicited
 
@@ -21,6 +23,33 @@
 #error "Tx buffer too large for dynamic allocation"
 #endif
 
+#ifndef AT_CLIENT_RX_CHUNKSIZE
+#define AT_CLIENT_RX_CHUNKSIZE 64   // bytes drained from serial per read
+#endif
+
+#define AT_MATCHER_BUILTIN_NODES 29   // result code trie for OK/ERROR/+CME
+#define AT_MATCHER_BUILTIN_PATTERNS 5
+#ifndef AT_CLIENT_RESULT_CODES
+#define AT_CLIENT_RESULT_CODES 8   // maximum user-registered result codes
+#endif
+#ifndef AT_CLIENT_RESULT_CODE_NODES
+#define AT_CLIENT_RESULT_CODE_NODES 8   // result code trie characters per code
+#endif
+#define AT_RESULT_CODE_SIZE 24   // maximum result code pattern length + 1
+
+#ifndef AT_CLIENT_URC_HANDLERS
+#define AT_CLIENT_URC_HANDLERS 8   // maximum registered URC handlers
+#endif
+#ifndef AT_CLIENT_URC_PREFIX_NODES
+#define AT_CLIENT_URC_PREFIX_NODES 8   // URC trie characters per handler
+#endif
+#ifndef AT_CLIENT_URC_SLOTS
+#define AT_CLIENT_URC_SLOTS 4   // URCs held while a command is in progress
+#endif
+#ifndef AT_CLIENT_URC_SLOT_SIZE
+#define AT_CLIENT_URC_SLOT_SIZE 64   // maximum queued URC length + 1
+#endif
+
 #ifndef AT_SERVER_RX_BUFFERSIZE
 #define AT_SERVER_RX_BUFFERSIZE 256
 #endif
@@ -44,6 +73,9 @@ typedef unsigned short at_error_t;
 #define AT_ERR_BAD_BYTE 255   // Non-ASCII character received on serial
 #define AT_ERR_CRC_CONFIG 254   // CRC expected but not found or vice versa
 #define AT_PENDING 253
+#define AT_ERR_BUSY 252   // A prior command is still pending
+#define AT_ERR_PARSE 251   // Response missing fields or with malformed values
+#define AT_ERR_CMD_LENGTH 250   // Command too long for the Tx buffer copy
 
 // Internal use within this library
 typedef unsigned short parse_state_t;
@@ -55,4 +87,28 @@ typedef unsigned short parse_state_t;
 #define AT_PARSE_ERROR 5
 #define AT_PARSE_COMMAND 6   // Server-side
 
+// Tags reported by the client's response matcher
+#define AT_MATCH_NONE 0
+#define AT_MATCH_ECHO 1
+#define AT_MATCH_OK 2
+#define AT_MATCH_ERROR 3
+#define AT_MATCH_CME 4   // error with information until end of line
+#define AT_MATCH_SHORT_OK 5
+#define AT_MATCH_SHORT_ERROR 6
+#define AT_MATCH_USER 16   // first tag of user-registered result codes
+
+// Kinds of result code registered with AtClient::addResultCode
+#define AT_RESULT_FINAL 0   // final result, complete as soon as matched
+#define AT_RESULT_LINE 1   // final result with information to end of line
+#define AT_RESULT_PROMPT 2   // intermediate result (e.g. `>`) ends the command
+
+/**
+ * @brief Fail the build if a client/server configuration exceeds a RAM budget,
+ * e.g. `AT_ASSERT_FOOTPRINT(8192, at::AtClientSized<512, 128>);`
+ * (the type is last so template argument commas need no extra parentheses)
+ */
+#define AT_ASSERT_FOOTPRINT(max_bytes, ...) \
+  static_assert(sizeof(__VA_ARGS__) <= (max_bytes), \
+                #__VA_ARGS__ " exceeds its RAM budget of " #max_bytes " bytes")
+
 #endif   // AT_CONSTANTS_H
\ No newline at end of file
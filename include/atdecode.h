@@ -0,0 +1,177 @@
+/**
+ * @file atdecode.h
+ * @brief Typed decoding of AT responses directly into structs
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ */
+#ifndef AT_DECODE_H
+#define AT_DECODE_H
+
+#include <Arduino.h>
+#include <limits>
+#include <type_traits>
+#include "atconstants.h"
+#include "atstringutils.h"
+#include "atclient.h"
+
+namespace at {
+
+/**
+ * @brief Parse a whole span as a signed integer, without copying.
+ * Leading `+`/`-` is accepted. Fails on empty, overflow or trailing chars.
+ */
+bool parseInt(const AtSpan& span, long& value, uint8_t base = 10);
+
+/**
+ * @brief Parse a whole span as an unsigned integer, without copying.
+ * Fails on empty, overflow, sign or trailing characters.
+ */
+bool parseUint(const AtSpan& span, unsigned long& value, uint8_t base = 10);
+
+/**
+ * @brief Field descriptor decoding an unsigned member from hexadecimal
+ */
+template <class S, typename T>
+struct AtHexField { T S::* member; };
+
+template <class S, typename T>
+AtHexField<S, T> hexField(T S::* member) { return AtHexField<S, T>{ member }; }
+
+/**
+ * @brief Field descriptor for a response field to be ignored
+ */
+struct AtSkipField {};
+
+namespace decode_detail {
+
+template <class S, typename T>
+typename std::enable_if<std::is_integral<T>::value &&
+                        std::is_signed<T>::value, bool>::type
+field(const AtSpan& param, S& out, T S::* member) {
+  long value;
+  if (!parseInt(param, value) ||
+      value < (long)std::numeric_limits<T>::min() ||
+      value > (long)std::numeric_limits<T>::max())
+    return false;
+  out.*member = (T)value;
+  return true;
+}
+
+template <class S, typename T>
+typename std::enable_if<std::is_integral<T>::value &&
+                        std::is_unsigned<T>::value &&
+                        !std::is_same<T, bool>::value, bool>::type
+field(const AtSpan& param, S& out, T S::* member, uint8_t base = 10) {
+  unsigned long value;
+  if (!parseUint(param, value, base) ||
+      value > (unsigned long)std::numeric_limits<T>::max())
+    return false;
+  out.*member = (T)value;
+  return true;
+}
+
+template <class S>
+bool field(const AtSpan& param, S& out, bool S::* member) {
+  if (param.equals("0") || param.equals("1")) {
+    out.*member = param.ptr[0] == '1';
+    return true;
+  }
+  return false;
+}
+
+template <class S>
+bool field(const AtSpan& param, S& out, AtSpan S::* member) {
+  out.*member = param;
+  return true;
+}
+
+template <class S, size_t N>
+bool field(const AtSpan& param, S& out, char (S::* member)[N]) {
+  if (param.len >= N)
+    return false;
+  memcpy(out.*member, param.ptr, param.len);
+  (out.*member)[param.len] = '\0';
+  return true;
+}
+
+template <class S, typename T>
+bool field(const AtSpan& param, S& out, AtHexField<S, T> hex) {
+  return field(param, out, hex.member, 16);
+}
+
+template <class S>
+bool field(const AtSpan&, S&, AtSkipField) { return true; }
+
+template <class S>
+bool fields(AtTokenizer&, S&) { return true; }   // extra fields are ignored
+
+template <class S, typename First, typename... Rest>
+bool fields(AtTokenizer& tokens, S& out, First first, Rest... rest) {
+  AtSpan param;
+  if (!tokens.next(param) || !field(param, out, first))
+    return false;
+  return fields(tokens, out, rest...);
+}
+
+}   // namespace decode_detail
+
+/**
+ * @brief Decode one response line into a struct.
+ * The shape is the ordered list of fields: member pointers (integer, bool,
+ * `AtSpan` or `char[N]`), `hexField(&S::member)` or `AtSkipField()`.
+ * 
+ * Example: `decodeLine(line, csq, &Csq::rssi, &Csq::ber)`
+ * 
+ * @param line The line (prefix already removed) e.g. from `nextLine`
+ * @param out The struct to populate
+ * @return AT_OK or AT_ERR_PARSE if a field is missing or malformed
+ */
+template <class S, typename... Fields>
+at_error_t decodeLine(const AtSpan& line, S& out, Fields... fields) {
+  AtTokenizer tokens(line);
+  return decode_detail::fields(tokens, out, fields...) ? AT_OK : AT_ERR_PARSE;
+}
+
+/**
+ * @brief Decode the first line of a response into a struct.
+ * 
+ * Example: `decodeResponse(modem.responseView("+CSQ:"), csq, &Csq::rssi,
+ * &Csq::ber)`
+ * 
+ * @return AT_OK or AT_ERR_PARSE if there is no line or it does not decode
+ */
+template <class S, typename... Fields>
+at_error_t decodeResponse(AtResponseView view, S& out, Fields... fields) {
+  AtSpan line;
+  if (!view.nextLine(line))
+    return AT_ERR_PARSE;
+  return decodeLine(line, out, fields...);
+}
+
+/**
+ * @brief Decode each line of a multi-line response into an array of structs
+ * 
+ * @param view The response view (lines are read from its current position)
+ * @param out The array to populate
+ * @param max_count The capacity of `out`
+ * @param count Set to the number of lines decoded
+ * @return AT_OK or AT_ERR_PARSE on the first line that does not decode
+ */
+template <class S, typename... Fields>
+at_error_t decodeLines(AtResponseView view, S* out, size_t max_count,
+                       size_t& count, Fields... fields) {
+  count = 0;
+  AtSpan line;
+  while (count < max_count && view.nextLine(line)) {
+    at_error_t error = decodeLine(line, out[count], fields...);
+    if (error != AT_OK)
+      return error;
+    count++;
+  }
+  return AT_OK;
+}
+
+}   // namespace at
+
+#endif   // AT_DECODE_H
@@ -0,0 +1,222 @@
+/**
+ * @file atmatcher.h
+ * @brief Incremental multi-pattern matcher for AT response parsing
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ */
+#ifndef AT_MATCHER_H
+#define AT_MATCHER_H
+
+#include <Arduino.h>
+
+namespace at {
+
+/**
+ * @brief An Aho-Corasick automaton over a fixed set of patterns, fed one
+ * character at a time. Each pattern carries a caller-defined tag (non-zero)
+ * that is reported when the pattern ends on the character just fed.
+ *
+ * Additionally tracks a single "echo" pattern (typically the pending command)
+ * by a cursor, so arbitrarily long commands do not consume trie nodes.
+ *
+ * Patterns are referenced, not copied, and must outlive the matcher.
+ * Holds the matching logic over node/pattern storage supplied by the owner,
+ * so it is compiled once whatever the capacity. Use `AtMatcher` to
+ * construct one with its own storage. With no storage it matches nothing.
+ */
+class AtMatcherBase {
+  public:
+    struct Node {
+      char c;
+      uint8_t pattern;   // 1-based index of a pattern ending here, or 0
+      uint16_t child;   // first child (0 = none, root is never a child)
+      uint16_t sibling;   // next sibling (0 = none)
+      uint16_t fail;   // longest proper suffix that is also a trie path
+      uint16_t output;   // nearest node on the fail chain ending a pattern
+    };
+    struct Pattern {
+      const char* str;
+      uint8_t len;
+      uint8_t tag;
+      uint16_t node;   // insertion cursor used by compile
+    };
+
+  private:
+    Node* const nodes;
+    Pattern* const patterns;
+    const uint16_t max_nodes;
+    const uint8_t max_patterns;
+    uint16_t node_count = 1;
+    uint8_t pattern_count = 0;
+    uint16_t state = 0;
+    bool compiled = false;
+    const char* echo = nullptr;
+    char echo_suffix = '\0';
+    size_t echo_len = 0;
+    size_t echo_pos = 0;
+    uint8_t echo_tag = 0;
+    size_t match_len = 0;
+
+    uint16_t childOf(uint16_t node, char c) const {
+      for (uint16_t n = nodes[node].child; n != 0; n = nodes[n].sibling) {
+        if (nodes[n].c == c)
+          return n;
+      }
+      return 0;
+    }
+
+    char echoAt(size_t i) const {
+      return echo[i] != '\0' ? echo[i] : echo_suffix;
+    }
+
+    size_t echoFallback(char c) const;
+
+  public:
+    /**
+     * @brief Construct a matcher over caller-owned storage
+     *
+     * @param nodes The trie nodes (sum of pattern lengths + 1)
+     * @param max_nodes The number of nodes
+     * @param patterns The pattern slots
+     * @param max_patterns The number of pattern slots
+     */
+    AtMatcherBase(Node* nodes, uint16_t max_nodes, Pattern* patterns,
+                  uint8_t max_patterns)
+        : nodes(nodes), patterns(patterns), max_nodes(max_nodes),
+          max_patterns(max_patterns) {
+      clear();
+    }
+    AtMatcherBase(const AtMatcherBase&) = delete;
+    AtMatcherBase& operator=(const AtMatcherBase&) = delete;
+
+    /**
+     * @brief Remove all patterns (the echo pattern is unaffected)
+     */
+    void clear();
+
+    /**
+     * @brief Add a pattern to be recognised.
+     * Takes effect on the next `compile` (called lazily by `feed`).
+     *
+     * @param pattern The (null-terminated) pattern, referenced not copied
+     * @param tag The non-zero tag reported when the pattern matches
+     * @return false if the pattern is empty or capacity is exceeded
+     */
+    bool add(const char* pattern, uint8_t tag);
+
+    /**
+     * @brief Build the trie and failure links for the current patterns.
+     * Runs in time proportional to the total pattern length, without
+     * working storage beyond the nodes.
+     *
+     * @return false if the node capacity is exceeded
+     */
+    bool compile();
+
+    /**
+     * @brief Set the echo pattern tracked alongside the trie
+     *
+     * @param pattern The expected echo (referenced not copied) or nullptr
+     * @param tag The non-zero tag reported when the echo completes
+     * @param suffix An optional character expected after `pattern` (e.g. the
+     * command terminator), so the echo need not be staged in a buffer
+     */
+    void setEcho(const char* pattern, uint8_t tag, char suffix = '\0');
+
+    /**
+     * @brief Return to the initial state without changing patterns
+     */
+    void reset() {
+      state = 0;
+      echo_pos = 0;
+      match_len = 0;
+    }
+
+    /**
+     * @brief Advance the matcher by one character.
+     * Amortized constant time regardless of how much has been fed.
+     *
+     * @param c The next character
+     * @return The tag of the (longest) pattern ending at `c`, or 0.
+     * The echo takes precedence over trie patterns ending at the same place.
+     */
+    uint8_t feed(char c) {
+      if (!compiled)
+        compile();
+      uint8_t tag = 0;
+      if (echo_len > 0) {
+        if (echoAt(echo_pos) == c) {
+          echo_pos++;
+        } else {
+          echo_pos = echoFallback(c);
+        }
+        if (echo_pos == echo_len) {
+          echo_pos = 0;
+          match_len = echo_len;
+          tag = echo_tag;
+        }
+      }
+      if (max_nodes == 0)
+        return tag;
+      uint16_t next = childOf(state, c);
+      while (next == 0 && state != 0) {
+        state = nodes[state].fail;
+        next = childOf(state, c);
+      }
+      state = next;
+      if (tag == 0) {
+        uint16_t hit = nodes[state].pattern != 0 ? state : nodes[state].output;
+        if (hit != 0) {
+          const Pattern& p = patterns[nodes[hit].pattern - 1];
+          match_len = p.len;
+          tag = p.tag;
+        }
+      }
+      return tag;
+    }
+
+    /**
+     * @brief Match the longest pattern that is a prefix of a string, walking
+     * the trie once from the root (failure links and echo are not used).
+     *
+     * @param str The string to test
+     * @param len The length of the string
+     * @return The tag of the longest pattern prefixing `str`, or 0
+     */
+    uint8_t matchPrefix(const char* str, size_t len);
+
+    /**
+     * @brief Get the length of the most recently reported match
+     */
+    size_t matchLength() const { return match_len; }
+
+    /**
+     * @brief Get the number of patterns that can be added
+     */
+    uint8_t capacity() const { return max_patterns; }
+};
+
+/**
+ * @brief An `AtMatcherBase` with its own storage
+ *
+ * @tparam MaxNodes The trie node capacity (sum of pattern lengths + 1)
+ * @tparam MaxPatterns The maximum number of patterns
+ */
+template <uint16_t MaxNodes, uint8_t MaxPatterns>
+class AtMatcher : public AtMatcherBase {
+  static_assert(MaxNodes > 0 && MaxPatterns > 0,
+                "Matcher storage must not be empty");
+
+  private:
+    Node node_storage[MaxNodes];
+    Pattern pattern_storage[MaxPatterns];
+
+  public:
+    AtMatcher()
+        : AtMatcherBase(node_storage, MaxNodes, pattern_storage, MaxPatterns) {}
+};
+
+}   // namespace at
+
+#endif   // AT_MATCHER_H
@@ -0,0 +1,173 @@
+/**
+ * @file atringbuffer.h
+ * @brief Lock-free single-producer/single-consumer byte ring for feeding the
+ * AT parser from a UART receive task or ISR
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ */
+#ifndef AT_RING_BUFFER_H
+#define AT_RING_BUFFER_H
+
+#include <Arduino.h>
+#include <atomic>
+
+namespace at {
+
+/**
+ * @brief A lock-free ring of bytes with exactly one producer (e.g. a UART
+ * receive task or ISR) and one consumer (the AT parser).
+ * Indices run freely and are masked on access, so all `Size` bytes are
+ * usable. Bytes pushed while full are discarded and counted.
+ * 
+ * @tparam Size The capacity in bytes (a power of 2)
+ */
+template <size_t Size>
+class AtRingBuffer {
+  static_assert(Size >= 2 && (Size & (Size - 1)) == 0,
+                "AtRingBuffer size must be a power of 2");
+
+  private:
+    uint8_t data[Size];
+    std::atomic<size_t> head{0};   // next write, advanced by producer only
+    std::atomic<size_t> tail{0};   // next read, advanced by consumer only
+    std::atomic<uint32_t> overflow_count{0};
+
+  public:
+    /**
+     * @brief (Producer) Add bytes, discarding any that do not fit
+     * 
+     * @return The number of bytes added
+     */
+    size_t push(const uint8_t* src, size_t len) {
+      size_t h = head.load(std::memory_order_relaxed);
+      size_t t = tail.load(std::memory_order_acquire);
+      size_t room = Size - (h - t);
+      size_t n = len < room ? len : room;
+      size_t offset = h & (Size - 1);
+      size_t first = n < Size - offset ? n : Size - offset;
+      memcpy(&data[offset], src, first);
+      memcpy(&data[0], src + first, n - first);
+      head.store(h + n, std::memory_order_release);
+      if (n < len)
+        overflow_count.fetch_add(len - n, std::memory_order_relaxed);
+      return n;
+    }
+
+    /**
+     * @brief (Producer) Add a byte e.g. from a UART receive interrupt
+     * 
+     * @return false if the buffer was full and the byte discarded
+     */
+    bool push(uint8_t b) { return push(&b, 1) == 1; }
+
+    /**
+     * @brief (Producer) Move all bytes available from a stream into the
+     * buffer, for use in a receive task
+     * 
+     * @return The number of bytes added
+     */
+    size_t fill(Stream& source) {
+      uint8_t chunk[64];
+      size_t total = 0;
+      int available = source.available();
+      while (available > 0) {
+        size_t want = (size_t)available < sizeof(chunk) ?
+                      (size_t)available : sizeof(chunk);
+        size_t got = source.readBytes((char*)chunk, want);
+        if (got == 0)
+          break;
+        total += push(chunk, got);
+        available = source.available();
+      }
+      return total;
+    }
+
+    /**
+     * @brief (Consumer) Remove up to `len` bytes
+     * 
+     * @return The number of bytes removed
+     */
+    size_t pop(uint8_t* dst, size_t len) {
+      size_t t = tail.load(std::memory_order_relaxed);
+      size_t h = head.load(std::memory_order_acquire);
+      size_t n = h - t < len ? h - t : len;
+      size_t offset = t & (Size - 1);
+      size_t first = n < Size - offset ? n : Size - offset;
+      memcpy(dst, &data[offset], first);
+      memcpy(dst + first, &data[0], n - first);
+      tail.store(t + n, std::memory_order_release);
+      return n;
+    }
+
+    /**
+     * @brief (Consumer) Remove a byte
+     * 
+     * @return The byte or -1 if empty
+     */
+    int pop() {
+      uint8_t b;
+      return pop(&b, 1) == 1 ? b : -1;
+    }
+
+    /**
+     * @brief (Consumer) Get the next byte without removing it
+     * 
+     * @return The byte or -1 if empty
+     */
+    int peek() const {
+      size_t t = tail.load(std::memory_order_relaxed);
+      if (head.load(std::memory_order_acquire) == t)
+        return -1;
+      return data[t & (Size - 1)];
+    }
+
+    /**
+     * @brief Get the number of bytes waiting to be consumed
+     */
+    size_t available() const {
+      return head.load(std::memory_order_acquire) -
+             tail.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Get the number of bytes discarded because the buffer was full
+     */
+    uint32_t overflows() const {
+      return overflow_count.load(std::memory_order_relaxed);
+    }
+
+    size_t capacity() const { return Size; }
+};
+
+/**
+ * @brief A Stream for AtClient that reads from an AtRingBuffer filled by a
+ * receive task or ISR, and writes directly to the underlying serial port.
+ * 
+ * @tparam Size The ring buffer capacity
+ */
+template <size_t Size>
+class AtRingStream : public Stream {
+  private:
+    AtRingBuffer<Size>& rx;
+    Stream& tx;
+
+  public:
+    AtRingStream(AtRingBuffer<Size>& rx, Stream& tx) : rx(rx), tx(tx) {}
+
+    int available() override { return (int)rx.available(); }
+    int read() override { return rx.pop(); }
+    int peek() override { return rx.peek(); }
+    size_t readBytes(char* buffer, size_t length) {
+      return rx.pop((uint8_t*)buffer, length);
+    }
+    size_t write(uint8_t c) override { return tx.write(c); }
+    size_t write(const uint8_t* buffer, size_t size) override {
+      return tx.write(buffer, size);
+    }
+    void flush() override { tx.flush(); }
+};
+
+}   // namespace at
+
+#endif   // AT_RING_BUFFER_H
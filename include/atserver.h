@@ -29,10 +29,48 @@ struct AtCommand {
   at_error_t (*write)(const char* params);
 };
 
+#if defined(__AVR__)
+#define AT_FLASH PROGMEM   // place a command table in flash, not SRAM
+#else
+#define AT_FLASH   // const data is already flash resident
+#endif
+
+/**
+ * @brief Compare two command names at compile time, like `strcmp`
+ */
+constexpr int commandNameCompare(const char* a, const char* b) {
+  return (*a != *b || *a == '\0') ?
+         (int)(unsigned char)*a - (int)(unsigned char)*b :
+         commandNameCompare(a + 1, b + 1);
+}
+
+/**
+ * @brief Check at compile time that a command table is strictly sorted by
+ * name, i.e. in lookup order and without duplicates
+ *
+ * @param table The command table
+ * @param count The number of commands in the table
+ */
+constexpr bool commandsSorted(const AtCommand* table, size_t count) {
+  return count < 2 ||
+         (commandNameCompare(table[0].name, table[1].name) < 0 &&
+          commandsSorted(table + 1, count - 1));
+}
+
+/**
+ * @brief Fail the build if a constexpr command table is not strictly sorted
+ * by name (see `AtServerBase::setCommandTable`)
+ */
+#define AT_ASSERT_COMMAND_TABLE(table) \
+  static_assert(at::commandsSorted(table, sizeof(table) / sizeof(table[0])), \
+                #table " must be sorted by name without duplicates")
+
 /**
- * @brief A class for serving AT responses to a client
+ * @brief A class for serving AT responses to a client.
+ * Holds the serving logic over an Rx buffer supplied by a derived class.
+ * Use `AtServer` or `AtServerSized` to construct one.
 */
-class AtServer {
+class AtServerBase {
   private:
     bool echo = true;
     bool verbose = true;
@@ -43,16 +81,20 @@ class AtServer {
     char vres_err[10];
     char res_ok[3];
     char res_err[3];
-    #if defined(__AVR__)
-    char rx_buffer_P[AT_SERVER_RX_BUFFERSIZE] PROGMEM;
-    #else
-    char rx_buffer[AT_SERVER_RX_BUFFERSIZE];
-    #endif
+    char* const rx_buffer;
+    const size_t rx_buffer_size;
+    size_t rx_len = 0;   // bytes in the Rx buffer excluding terminating null
     char working_buffer[128];
     bool initialized = false;
     parse_state_t parsing = AT_PARSE_NONE;
     at_error_t last_error_code = 0;
-    std::vector<AtCommand> commands = {};
+    std::vector<AtCommand> commands = {};   // sorted by name
+    const AtCommand* command_table = nullptr;   // sorted, may be in flash
+    size_t command_table_size = 0;
+    AtCommand table_entry;   // SRAM copy of a flash entry being examined
+    const AtCommand* tableEntry(size_t index);
+    const AtCommand* findCommand(const char* name, size_t len);
+    bool handleBuiltIn(const char* cmd);
     bool readSerialChar(bool ignore_unprintable = true);
     char lastCharRead(size_t n = 1);
     bool isRxBufferFull();
@@ -66,8 +108,12 @@ class AtServer {
   public:
     /**
      * @brief Construct at AT command server using a serial stream
+     * 
+     * @param serial The Stream reference associated with the serial port
+     * @param rx_buffer The command buffer, owned by the derived class
+     * @param rx_size The size of the command buffer
     */
-    AtServer(Stream& serial);
+    AtServerBase(Stream& serial, char* rx_buffer, size_t rx_size);
 
     /**
      * @brief Add a command to the supported serving list
@@ -78,6 +124,23 @@ class AtServer {
     */
     bool addCommand(AtCommand* new_cmd, bool replace = false);
 
+    /**
+     * @brief Serve a fixed command table, referenced not copied, so a
+     * `constexpr` table costs no heap and no registration at startup, e.g.
+     * `static constexpr at::AtCommand table[] AT_FLASH = {...};`
+     * The table must be sorted by name (check with `AT_ASSERT_COMMAND_TABLE`).
+     * Commands added by `addCommand` take precedence over the table.
+     * 
+     * @param table The command table, or nullptr to remove it
+     * @param count The number of commands in the table
+     * @returns false (and no table is served) if it is not strictly sorted
+    */
+    bool setCommandTable(const AtCommand* table, size_t count);
+    template <size_t N>
+    bool setCommandTable(const AtCommand (&table)[N]) {
+      return setCommandTable(table, N);
+    }
+
     /**
      * @brief Check the serial stream for an incoming command to parse
      * 
@@ -132,6 +195,32 @@ class AtServer {
     void sendError();
 };
 
+/**
+ * @brief An AT server with its Rx buffer sized at compile time
+ * 
+ * @tparam RxSize The command buffer size, bounding the longest command line
+*/
+template <size_t RxSize = AT_SERVER_RX_BUFFERSIZE>
+class AtServerSized : public AtServerBase {
+  static_assert(RxSize >= 8, "Rx buffer must hold at least a short command");
+
+  private:
+    char rx_storage[RxSize];
+
+  public:
+    /**
+     * @brief Construct at AT command server using a serial stream
+    */
+    AtServerSized(Stream& serial) : AtServerBase(serial, rx_storage, RxSize) {
+      rx_storage[0] = '\0';
+    }
+};
+
+/**
+ * @brief The AT server with the default (`AT_SERVER_RX_BUFFERSIZE`) buffer
+*/
+typedef AtServerSized<> AtServer;
+
 }   // namespace at
 
 #endif   // AT_SERVER_H
\ No newline at end of file
@@ -18,6 +18,25 @@
 
 namespace at {
 
+/**
+ * @brief A non-owning view of a run of characters within a larger buffer.
+ * Not null-terminated, valid only as long as the underlying buffer.
+ */
+struct AtSpan {
+  const char* ptr;
+  size_t len;
+  AtSpan() : ptr(nullptr), len(0) {}
+  AtSpan(const char* ptr, size_t len) : ptr(ptr), len(len) {}
+  bool empty() const { return len == 0; }
+  bool equals(const char* str) const {
+    return strlen(str) == len && strncmp(ptr, str, len) == 0;
+  }
+  bool startsWith(const char* str) const {
+    size_t str_len = strlen(str);
+    return str_len <= len && strncmp(ptr, str, str_len) == 0;
+  }
+};
+
 /**
  * @brief Print a printable character or known substitutions or the int value.
  * Known substitiions: <cr>, <lf>. Unprintable values appear as `[ <int> ]`.
@@ -169,6 +188,44 @@ void trim(String& str);
 long getNextParameter(char* at_param, const char* response,
                       size_t buffer_size, const char sep = ',');
 
+/**
+ * @brief A cursor over the parameters of a response line, yielding each as
+ * an `AtSpan` into the original buffer without copying.
+ * Handles empty fields (`1,,3`) and quoted strings containing separators.
+ * Line feeds are not special - iterate lines with `AtResponseView::nextLine`.
+ */
+class AtTokenizer {
+  private:
+    const char* data;
+    size_t data_len;
+    size_t pos = 0;
+    char sep;
+    bool done;
+  
+  public:
+    AtTokenizer(const char* str, const char sep = ',');
+    AtTokenizer(const AtSpan& span, const char sep = ',');
+
+    /**
+     * @brief Get the next parameter, with surrounding spaces removed
+     * 
+     * @param param Set to the parameter (empty for an empty field)
+     * @param unquote Remove enclosing double quotes (default true)
+     * @return false if there are no more parameters
+     */
+    bool next(AtSpan& param, bool unquote = true);
+
+    /**
+     * @brief Check if all parameters have been read
+     */
+    bool atEnd() const { return done; }
+
+    /**
+     * @brief Get the offset of the next parameter relative to the start
+     */
+    size_t offset() const { return pos; }
+};
+
 /**
  * @brief Convert an unsigned integer to ASCII string
  * 
@@ -0,0 +1,80 @@
+/**
+ * @file aturcqueue.h
+ * @brief Bounded queue of unsolicited result code lines
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ */
+#ifndef AT_URC_QUEUE_H
+#define AT_URC_QUEUE_H
+
+#include <Arduino.h>
+#include "atdebug.h"
+#include "atconstants.h"
+
+namespace at {
+
+/**
+ * @brief A fixed ring of line slots holding URCs until the application
+ * drains them. When full the oldest URC is dropped, and lines longer than a
+ * slot are truncated. The slots are supplied by the owner; with none every
+ * URC is dropped.
+ */
+class AtUrcQueue {
+  private:
+    char* const slots;
+    const uint8_t slot_count;
+    const uint16_t slot_size;
+    uint8_t head = 0;   // oldest queued line
+    uint8_t count = 0;
+    uint16_t dropped_count = 0;
+    char* slot(uint8_t index) { return slots + (size_t)index * slot_size; }
+
+  public:
+    /**
+     * @brief Construct a queue over caller-owned slots
+     * 
+     * @param slots `slot_count` contiguous slots of `slot_size` characters
+     * @param slot_count The number of URCs held
+     * @param slot_size The maximum URC length + 1
+     */
+    AtUrcQueue(char* slots, uint8_t slot_count, uint16_t slot_size)
+        : slots(slots), slot_count(slot_count), slot_size(slot_size) {}
+    AtUrcQueue(const AtUrcQueue&) = delete;
+    AtUrcQueue& operator=(const AtUrcQueue&) = delete;
+
+    /**
+     * @brief Add a line to the queue, dropping the oldest if full
+     * 
+     * @param line The URC (need not be null-terminated)
+     * @param len The length of the URC excluding any line terminators
+     * @return false if the oldest URC was dropped to make room
+     */
+    bool push(const char* line, size_t len);
+
+    /**
+     * @brief Remove the oldest line from the queue
+     * 
+     * @param line The buffer to copy the URC into
+     * @param buffer_size The size of the buffer
+     * @return false if the queue is empty
+     */
+    bool pop(char* line, size_t buffer_size);
+
+    /**
+     * @brief Get the number of queued URCs
+     */
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+
+    /**
+     * @brief Get the number of URCs dropped due to overflow
+     */
+    uint16_t dropped() const { return dropped_count; }
+
+    void clear();
+};
+
+}   // namespace at
+
+#endif   // AT_URC_QUEUE_H
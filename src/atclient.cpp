@@ -2,6 +2,13 @@
 
 namespace at {
 
+/**
+ * @brief Check if a deadline has passed, robust to `millis()` rollover
+ */
+static bool deadlinePassed(uint32_t deadline) {
+  return (int32_t)(millis() - deadline) >= 0;
+}
+
 static const char rx_trace_tag[] = "[V][RAW RX <<<] ";
 static const char tx_trace_tag[] = "[V][RAW TX >>>] ";
 
@@ -9,7 +16,7 @@ static const char tx_trace_tag[] = "[V][RAW TX >>>] ";
  * @brief Add a preamble to raw character debug or newline for other debug
  * @param raw Adds a preamble for raw character logging
 */
-void AtClient::toggleRaw(bool raw) {
+void AtClientBase::toggleRaw(bool raw) {
   if (ardebugGetLevel() > ARDEBUG_D) {
     if (raw) {
       if (!debug_raw)
@@ -23,32 +30,34 @@ void AtClient::toggleRaw(bool raw) {
   }
 }
 
-char* AtClient::responsePtr() {
-#if defined(__AVR__)
-  return &at_rx_buffer_P[0];
-#else  
-  return &at_rx_buffer[0];
-#endif
+char* AtClientBase::responsePtr() {
+  return at_rx_buffer;
 }
 
-char* AtClient::commandPtr() {
-#if defined(__AVR__)
-  return &at_tx_buffer_P[0];
-#else
-  return &at_tx_buffer[0];
-#endif
+const char* AtClientBase::commandPtr() {
+  return pending_cmd;
+}
+
+size_t AtClientBase::rxMatchOffset() {
+  // a streamed response may no longer hold the start of the match
+  size_t len = matcher.matchLength();
+  return rx_len > len ? rx_len - len : 0;
 }
 
-bool AtClient::isRxBufferFull() {
-  return strlen(responsePtr()) >= rx_buffer_size - 1;
+bool AtClientBase::isRxBufferFull() {
+  return rx_len >= rx_buffer_size - 1;
 }
 
-void AtClient::clearRxBuffer() {
-  memset(responsePtr(), 0, rx_buffer_size);
+void AtClientBase::clearRxBuffer() {
+  responsePtr()[0] = '\0';   // contents are only valid up to rx_len
+  rx_len = 0;
+  line_start = 0;
+  rx_clean = false;
+  result_offset = rx_buffer_size;
   response_ready = false;
 }
 
-void AtClient::getResponse(char* response, const char* prefix, size_t buffer_size,
+void AtClientBase::getResponse(char* response, const char* prefix, size_t buffer_size,
                            bool clean) {
   if (clean) cleanResponse(prefix);
   strncpy(response, responsePtr(), buffer_size);
@@ -56,45 +65,105 @@ void AtClient::getResponse(char* response, const char* prefix, size_t buffer_siz
   response_ready = false;
 }
 
-void AtClient::getResponse(String& response, const char* prefix, bool clean) {
+void AtClientBase::getResponse(String& response, const char* prefix, bool clean) {
   response = sgetResponse(prefix);
 }
 
-String AtClient::sgetResponse(const char* prefix, bool clean) {
+String AtClientBase::sgetResponse(const char* prefix, bool clean) {
   if (clean) cleanResponse(prefix);
+  String response = String(responsePtr());
   clearRxBuffer();
   response_ready = false;
-  return String(responsePtr());
+  return response;
+}
+
+AtResponseView AtClientBase::responseView(const char* prefix) {
+  if (!response_ready)
+    return AtResponseView();
+  size_t end = result_offset < rx_len ? result_offset : rx_len;
+  return AtResponseView(responsePtr(), end, prefix);
+}
+
+AtResponseView::AtResponseView(const char* data, size_t length,
+                               const char* prefix) : prefix(prefix) {
+  size_t start = 0;
+  while (start < length && isspace((unsigned char)data[start]))
+    start++;
+  while (length > start && isspace((unsigned char)data[length - 1]))
+    length--;
+  payload_data = data + start;
+  payload_len = length - start;
+  prefix_len = prefix != nullptr ? strlen(prefix) : 0;
+}
+
+bool AtResponseView::nextLine(AtSpan& line) {
+  const char* end = payload_data + payload_len;
+  while (line_pos < payload_len) {
+    const char* start = payload_data + line_pos;
+    const char* lf = (const char*)memchr(start, AT_LF, end - start);
+    const char* stop = lf != nullptr ? lf : end;
+    line_pos = (stop - payload_data) + (lf != nullptr ? 1 : 0);
+    while (stop > start && (*(stop - 1) == AT_CR || *(stop - 1) == ' '))
+      stop--;
+    if (stop == start)
+      continue;   // blank line between V1 information responses
+    if (prefix_len > 0 && (size_t)(stop - start) >= prefix_len &&
+        strncmp(start, prefix, prefix_len) == 0) {
+      start += prefix_len;
+      while (start < stop && *start == ' ')
+        start++;
+    }
+    line.ptr = start;
+    line.len = stop - start;
+    return true;
+  }
+  return false;
 }
 
-void AtClient::clearPendingCommand() {
-  memset(commandPtr(), 0, tx_buffer_size);
+void AtClientBase::clearPendingCommand() {
+  at_tx_buffer[0] = '\0';
+  pending_cmd = at_tx_buffer;
 }
 
-bool AtClient::setPendingCommand(const char *at_command) {
-  if (strlen(at_command) > tx_buffer_size) {
+bool AtClientBase::setPendingCommand(const char *at_command, bool copy) {
+  if (!copy) {
+    pending_cmd = at_command;   // caller keeps it until the response completes
+    return true;
+  }
+  size_t len = strlen(at_command);
+  if (len >= tx_buffer_size) {
     AR_LOGE("Command %s too long for Tx buffer", at_command);
     return false;
   }
-  char tmp[tx_buffer_size];
-  // strncpy(tmp, at_command, tx_buffer_size);
-  // if (crc) applyCrc(tmp, tx_buffer_size);
-  snprintf(commandPtr(), tx_buffer_size, "%s\r", at_command);
+  memcpy(at_tx_buffer, at_command, len + 1);
+  pending_cmd = at_tx_buffer;
   return true;
 }
 
-char AtClient::lastCharRead(size_t n) {
-  char* buffer = responsePtr();
-  if (n <= 0 || strlen(buffer) < n)
+bool AtClientBase::rxStartsWith(const char* prefix) {
+  size_t len = strlen(prefix);
+  return len > 0 && rx_len >= len && strncmp(responsePtr(), prefix, len) == 0;
+}
+
+bool AtClientBase::rxEndsWith(const char* suffix) {
+  size_t len = strlen(suffix);
+  return len > 0 && rx_len >= len &&
+         memcmp(responsePtr() + rx_len - len, suffix, len) == 0;
+}
+
+char AtClientBase::lastCharRead(size_t n) {
+  if (n <= 0 || rx_len < n)
     return -1;
-  return buffer[strlen(buffer) - n];
+  return responsePtr()[rx_len - n];
 }
 
 // If any data is on the serial port read until a match of read_until
-bool AtClient::checkUrc(const char* read_until, uint32_t timeout_ms,
+bool AtClientBase::checkUrc(const char* read_until, uint32_t timeout_ms,
                         const char prefix, uint16_t wait_ms) {
-  // TODO: semaphore lock
-  if (wait_ms == 0 && serial.available() == 0) {
+  // not thread-safe - share a client between tasks via AtClientWorker
+  if (cmd_pending)
+    return false;   // unsolicited data is handled by the pending command
+  if (wait_ms == 0 && rxAvailable() == 0) {
     // if (strlen(commandPtr()) > 0) AR_LOGW("AT command pending");
     // if (serial.available() == 0) AR_LOGD("No data");
     // if (busy) AR_LOGW("Busy with prior operation");
@@ -110,36 +179,54 @@ bool AtClient::checkUrc(const char* read_until, uint32_t timeout_ms,
   toggleRaw(true);
   clearRxBuffer();
   bool urc_found = false;
-  for (uint32_t start = millis(); (millis() - start) < timeout_ms;) {
-    if (!readSerialChar() && urc_found) {
-      toggleRaw(false);
-      AR_LOGW("Bad serial byte while parsing URC");
-      cmd_error = AT_ERR_BAD_BYTE;
-      break;
+  // runs of plain text can be copied in bulk if they cannot end read_until
+  char until_last = read_until[strlen(read_until) - 1];
+  bool bulk = (until_last == AT_CR || until_last == AT_LF ||
+               until_last == CRC_SEP);
+  uint32_t deadline = millis() + timeout_ms;
+  while (waitForRx(deadline)) {
+    if (urc_found && bulk)
+      readSerialText();
+    if (!readSerialChar()) {
+      if (urc_found) {
+        toggleRaw(false);
+        AR_LOGW("Bad serial byte while parsing URC");
+        cmd_error = AT_ERR_BAD_BYTE;
+        break;
+      }
+      if (isRxBufferFull()) {
+        toggleRaw(false);
+        AR_LOGW("Rx buffer full without URC prefix");
+        break;
+      }
     }
     if (!urc_found) {
-      if (lastCharRead() == prefix) {
+      char c = lastCharRead();
+      if (prefix == '\0' ? !isspace((unsigned char)c) : c == prefix) {
         urc_found = true;
-        if (!startsWith(responsePtr(), terminator) &&
-            !startsWith(responsePtr(), prefix)) {
+        if (!rxStartsWith(terminator) && responsePtr()[0] != c) {
           toggleRaw(false);
 #ifndef ARDEBUG_DISABLED
           AR_LOGW("Dumping pre-URC data: %s", sDbgRes().c_str());
 #endif
           clearRxBuffer();
-          responsePtr()[0] = prefix;
+          responsePtr()[0] = c;
+          responsePtr()[1] = '\0';
+          rx_len = 1;
           toggleRaw(true);
         }
       }
-    } else if (strlen(responsePtr()) > (strlen(read_until) + 1) &&
-               endsWith(responsePtr(), read_until)) {
+    } else if (rx_len > (strlen(read_until) + 1) &&
+               rxEndsWith(read_until)) {
       response_ready = true;
       break;
     }
+    if (deadlinePassed(deadline))
+      break;   // data may keep arriving without read_until
   }
   toggleRaw(false);
   if (!response_ready) {
-    if (strlen(responsePtr()) > 0)
+    if (rx_len > 0)
       AR_LOGW("URC timeout no prefix and/or terminator: %s", sDbgRes().c_str());
     clearRxBuffer();
   }
@@ -148,140 +235,549 @@ bool AtClient::checkUrc(const char* read_until, uint32_t timeout_ms,
   return response_ready;
 }
 
-at_error_t AtClient::sendAtCommand(const char *at_command, uint16_t timeout_ms) {
-  // TODO: semaphore lock, possible URC event
-  if (serial.available() > 0) {
-    while (serial.available() > 0) {
+bool AtClientBase::addUrcHandler(const char* prefix, at_urc_cb_t handler) {
+  if (handler == nullptr || urc_handler_count >= urc_matcher.capacity() ||
+      !urc_matcher.add(prefix, urc_handler_count + 1)) {
+    AR_LOGE("Unable to register URC handler %s", prefix);
+    return false;
+  }
+  urc_handlers[urc_handler_count++] = handler;
+  if (!urc_matcher.compile()) {
+    AR_LOGE("URC matcher full");
+    return false;
+  }
+  return true;
+}
+
+void AtClientBase::clearUrcHandlers() {
+  urc_matcher.clear();
+  urc_handler_count = 0;
+}
+
+bool AtClientBase::queueUrc(const char* line, size_t len) {
+  while (len > 0 && (line[len - 1] == AT_CR || line[len - 1] == AT_LF))
+    len--;
+  if (len == 0 || urc_matcher.matchPrefix(line, len) == 0)
+    return false;
+  if (cmd_pending) {
+    // a response to the pending command may share the URC prefix e.g. +CREG:
+    const char* name = commandPtr();
+    if (strncasecmp(name, "AT", 2) == 0)
+      name += 2;
+    size_t name_len = strcspn(name, "=?;\r");
+    if (name_len > 0 && len > name_len && line[name_len] == ':' &&
+        strncmp(line, name, name_len) == 0)
+      return false;
+  }
+  urc_queue.push(line, len);
+#ifndef ARDEBUG_DISABLED
+  AR_LOGD("Queued URC: %s", debugString(line, 0, len).c_str());
+#endif
+  return true;
+}
+
+bool AtClientBase::getQueuedUrc(char* urc, size_t buffer_size) {
+  return urc_queue.pop(urc, buffer_size);
+}
+
+bool AtClientBase::dispatchUrc(uint32_t timeout_ms, uint16_t wait_ms) {
+  if (!urc_queue.empty() && !cmd_pending) {
+    clearRxBuffer();
+    urc_queue.pop(responsePtr(), rx_buffer_size);
+    rx_len = strlen(responsePtr());
+    response_ready = true;
+  } else if (!checkUrc(nullptr, timeout_ms, '\0', wait_ms)) {
+    return false;
+  }
+  cleanResponse();
+  const char* urc = responsePtr();
+  uint8_t tag = urc_matcher.matchPrefix(urc, rx_len);
+  if (tag == 0) {
+    AR_LOGD("No handler for URC: %s", urc);
+    return true;
+  }
+  const char* params = urc + urc_matcher.matchLength();
+  while (*params == ' ')
+    params++;
+  urc_handlers[tag - 1](urc, params);
+  clearRxBuffer();
+  return true;
+}
+
+bool AtClientBase::transmitCommand(const char *at_command, bool copy,
+                                   bool flush) {
+  // not thread-safe - share a client between tasks via AtClientWorker
+  if (rxAvailable() > 0) {
+    while (rxAvailable() > 0) {
+      readSerialText();
       readSerialChar();
     }
+    // keep registered URCs, only unrecognised data is dumped
+    const char* res = responsePtr();
+    const char* end = res + rx_len;
+    for (const char* line = res; line < end;) {
+      const char* lf = (const char*)memchr(line, AT_LF, end - line);
+      const char* next = lf != nullptr ? lf + 1 : end;
+      size_t len = next - line;
+      if (!queueUrc(line, len) && strspn(line, "\r\n") < len) {
 #ifndef ARDEBUG_DISABLED
-    AR_LOGW("Dumping unsolicited Rx data: %s", sDbgRes().c_str());
-  }
+        AR_LOGW("Dumping unsolicited Rx data: %s",
+                debugString(line, 0, len).c_str());
 #endif
+      }
+      line = next;
+    }
+  }
   clearRxBuffer();
-  serial.flush();   // Wait for any prior outgoing data to complete
-  setPendingCommand(at_command);
+  if (!setPendingCommand(at_command, copy)) {
+    cmd_error = AT_ERR_CMD_LENGTH;
+    return false;
+  }
 #ifndef ARDEBUG_DISABLED
   AR_LOGD("Sending command: %s", sDbgReq().c_str());
   if (ardebugGetLevel() > ARDEBUG_D)
     ardprintf("%s%s\n", tx_trace_tag, sDbgReq().c_str());
 #endif
-  size_t wrote = serial.print(commandPtr());
-  if (wrote < strlen(commandPtr())) {
+  // written in segments straight from the caller, the terminator last
+  size_t cmd_len = strlen(at_command);
+  size_t wrote = serial.write(at_command, cmd_len);
+  wrote += serial.write((uint8_t)AT_CR);
+  if (wrote < cmd_len + 1) {
     AR_LOGE("Failed to write all bytes");
     cmd_error = AT_ERR_BAD_BYTE;
-    return cmd_error;
+    clearPendingCommand();
+    return false;
   }
-  serial.flush();
+  if (flush)
+    serial.flush();
+  return true;
+}
+
+at_error_t AtClientBase::sendAtCommand(const char *at_command, uint16_t timeout_ms) {
+  if (cmd_pending) {
+    AR_LOGW("Prior command pending - use poll() to complete");
+    return AT_ERR_BUSY;
+  }
+  if (!transmitCommand(at_command, timeout_ms == 0, tx_flush))
+    return cmd_error;
   if (timeout_ms > 0) return readAtResponse(timeout_ms);
-  else return AT_PENDING;
+  startResponse(AT_TIMEOUT_MS);
+  return AT_PENDING;
 }
 
-at_error_t AtClient::sendAtCommand(const String &at_command, uint16_t timeout_ms) {
+bool AtClientBase::submitAtCommand(const char *at_command, uint32_t timeout_ms,
+                               at_response_cb_t callback) {
+  if (cmd_pending) {
+    AR_LOGW("Prior command pending - use poll() to complete");
+    return false;
+  }
+  if (!transmitCommand(at_command, true, false))
+    return false;
+  cmd_callback = callback;
+  startResponse(timeout_ms);
+  return true;
+}
+
+at_error_t AtClientBase::poll() {
+  if (!cmd_pending)
+    return cmd_error;
+  if (!parseResponse())
+    return AT_PENDING;
+  at_error_t result = finishResponse();
+  at_response_cb_t callback = cmd_callback;
+  cmd_callback = nullptr;
+  if (callback != nullptr) {
+    if (response_ready) cleanResponse();
+    callback(result, response_ready ? responsePtr() : "");
+  }
+  return result;
+}
+
+at_error_t AtClientBase::sendAtCommandData(const char* at_command,
+                                       const char* header, uint8_t* data,
+                                       size_t data_size, size_t& data_len,
+                                       uint16_t timeout_ms,
+                                       uint8_t length_param) {
+  data_header = header;
+  data_param = length_param;
+  data_buffer = data;
+  this->data_size = data_size;
+  data_sink = nullptr;
+  data_context = nullptr;
+  at_error_t error = sendDataCommand(at_command, timeout_ms);
+  data_len = data_received;
+  return error;
+}
+
+at_error_t AtClientBase::sendAtCommandData(const char* at_command,
+                                       const char* header, at_data_sink_t sink,
+                                       void* context, size_t& data_len,
+                                       uint16_t timeout_ms,
+                                       uint8_t length_param) {
+  data_header = header;
+  data_param = length_param;
+  data_buffer = nullptr;
+  data_size = 0;
+  data_sink = sink;
+  data_context = context;
+  at_error_t error = sendDataCommand(at_command, timeout_ms);
+  data_len = data_received;
+  return error;
+}
+
+at_error_t AtClientBase::sendAtCommandLines(const char* at_command,
+                                        at_line_cb_t sink, void* context,
+                                        uint16_t timeout_ms) {
+  line_sink = sink;
+  line_context = context;
+  at_error_t error = sendAtCommand(at_command,
+                                   timeout_ms > 0 ? timeout_ms : AT_TIMEOUT_MS);
+  line_sink = nullptr;
+  line_context = nullptr;
+  return error;
+}
+
+void AtClientBase::sinkLine(bool complete) {
+  char* res = responsePtr();
+  size_t len = rx_len - line_start;
+  if (complete) {
+    while (len > 0 && (res[line_start + len - 1] == AT_LF ||
+                       res[line_start + len - 1] == AT_CR))
+      len--;
+  }
+  if (len > 0 || !complete)
+    line_sink(&res[line_start], len, complete, line_context);
+  rx_len = line_start;   // only the unfinished line is kept in the buffer
+  res[rx_len] = '\0';
+}
+
+at_error_t AtClientBase::sendDataCommand(const char* at_command,
+                                     uint16_t timeout_ms) {
+  data_received = 0;
+  at_error_t error = sendAtCommand(at_command,
+                                   timeout_ms > 0 ? timeout_ms : AT_TIMEOUT_MS);
+  data_header = nullptr;
+  return error;
+}
+
+void AtClientBase::readPayload(const char* header_line) {
+  data_header = nullptr;   // only one payload per command
+  AtTokenizer params(header_line + strcspn(header_line, ":") + 1);
+  AtSpan param;
+  for (uint8_t i = 0; i <= data_param; i++) {
+    if (!params.next(param))
+      param = AtSpan();
+  }
+  unsigned long length = 0;
+  for (size_t i = 0; i < param.len && isdigit((unsigned char)param.ptr[i]); i++)
+    length = length * 10 + (param.ptr[i] - '0');
+  AR_LOGD("Reading %lu byte payload", length);
+  uint32_t remaining = deadlinePassed(cmd_deadline) ? 0 : cmd_deadline - millis();
+  if (data_buffer != nullptr) {
+    size_t to_buffer = length < data_size ? length : data_size;
+    data_received = readData(data_buffer, to_buffer, remaining);
+    if (data_received == to_buffer && length > to_buffer) {
+      AR_LOGW("Payload exceeds buffer - discarding %lu bytes",
+              length - to_buffer);
+      remaining = deadlinePassed(cmd_deadline) ? 0 : cmd_deadline - millis();
+      data_received += readData(nullptr, nullptr, length - to_buffer, remaining);
+    }
+  } else {
+    data_received = readData(data_sink, data_context, length, remaining);
+  }
+  if (data_received < length)
+    AR_LOGW("Payload timeout after %d of %lu bytes", (int)data_received,
+            length);
+}
+
+size_t AtClientBase::readData(uint8_t* data, size_t length, uint32_t timeout_ms) {
+  uint32_t deadline = millis() + timeout_ms;
+  size_t total = 0;
+  data_mode = true;
+  while (total < length) {
+    size_t want = length - total;
+    if (chunk_pos < chunk_len) {
+      size_t n = chunk_len - chunk_pos < want ? chunk_len - chunk_pos : want;
+      memcpy(&data[total], &rx_chunk[chunk_pos], n);
+      chunk_pos += n;
+      total += n;
+      continue;
+    }
+    int waiting = serial.available();
+    if (waiting > 0) {   // straight into the caller's buffer
+      size_t n = (size_t)waiting < want ? (size_t)waiting : want;
+      total += serial.readBytes((char*)&data[total], n);
+    } else if (!waitForRx(deadline)) {
+      break;
+    }
+  }
+  data_mode = false;
+  return total;
+}
+
+size_t AtClientBase::readData(at_data_sink_t sink, void* context, size_t length,
+                          uint32_t timeout_ms) {
+  uint32_t deadline = millis() + timeout_ms;
+  size_t total = 0;
+  data_mode = true;
+  while (total < length && waitForRx(deadline)) {
+    size_t n = chunk_len - chunk_pos;
+    if (n > length - total)
+      n = length - total;
+    if (sink != nullptr)
+      sink((const uint8_t*)&rx_chunk[chunk_pos], n, context);
+    chunk_pos += n;
+    total += n;
+  }
+  data_mode = false;
+  return total;
+}
+
+size_t AtClientBase::writeData(const uint8_t* data, size_t length) {
+  size_t wrote = serial.write(data, length);
+  if (wrote < length)
+    AR_LOGE("Failed to write all bytes (%d of %d)", (int)wrote, (int)length);
+  return wrote;
+}
+
+at_error_t AtClientBase::sendAtCommand(const String &at_command, uint16_t timeout_ms) {
   return sendAtCommand(at_command.c_str(), timeout_ms);
 }
 
-at_error_t AtClient::readAtResponse(uint16_t timeout_ms) {
+void waitDelay(uint32_t max_ms, void* context) {
+  (void)context;
+  if (max_ms > 0)
+    delay(1);
+}
+
+void waitYield(uint32_t max_ms, void* context) {
+  (void)max_ms;
+  (void)context;
+  yield();
+}
+
+void AtClientBase::setWaitFunction(at_wait_fn_t wait, void* context) {
+  wait_fn = wait != nullptr ? wait : waitDelay;
+  wait_context = context;
+}
+
+bool AtClientBase::waitForRx(uint32_t deadline) {
+  while (rxAvailable() == 0) {
+    if (deadlinePassed(deadline) || lineIdle())
+      return false;
+    uint32_t max_ms = deadline - millis();
+    if (idle_match != AT_MATCH_NONE) {
+      // rounded up, so a sub-millisecond idle window still sleeps
+      uint32_t idle_ms = (idle_us - (micros() - last_rx_us) + 999) / 1000;
+      if (idle_ms == 0)
+        idle_ms = 1;
+      if (idle_ms < max_ms)
+        max_ms = idle_ms;
+    }
+    wait_fn(max_ms, wait_context);
+  }
+  return true;
+}
+
+bool AtClientBase::lineIdle() {
+  return idle_match != AT_MATCH_NONE && micros() - last_rx_us >= idle_us;
+}
+
+uint32_t AtClientBase::idleMicros(uint32_t baud) {
+  if (baud == 0 || baud > 19200)
+    return AT_IDLE_MIN_US;
+  return (uint32_t)(AT_IDLE_CHARS_X10 * 11 * 100000UL / baud);
+}
+
+void AtClientBase::setBaudRate(uint32_t baud) {
+  idle_us = idleMicros(baud);
+}
+
+void AtClientBase::setIdleTimeout(uint32_t idle_us) {
+  this->idle_us = idle_us;
+}
+
+at_error_t AtClientBase::readAtResponse(uint16_t timeout_ms) {
+  startResponse(timeout_ms);
+  AR_LOGV("Timeout: %d ms", timeout_ms);
+  while (!parseResponse())
+    waitForRx(cmd_deadline);
+  return finishResponse();
+}
+
+void AtClientBase::startResponse(uint32_t timeout_ms) {
   // busy = true;   // should be redundant
 #ifndef ARDEBUG_DISABLED
   AR_LOGV("Parsing response to %s for %d ms", sDbgReq().c_str(), timeout_ms);
 #endif
   cmd_parsing = echo ? AT_PARSE_ECHO : AT_PARSE_RESPONSE;
   cmd_error = AT_ERROR;
-  uint16_t countdown = (uint16_t)(timeout_ms / 1000);
-  uint32_t tick = ardebugGetLevel() > ARDEBUG_D ? 1 : 0;
-  AR_LOGV("Timeout: %d ms; Countdown: %d s", timeout_ms, countdown);
-  for (uint32_t start = millis(); millis() - start < timeout_ms;) {
-    while (serial.available() > 0 && cmd_parsing < AT_PARSE_OK) {
-      toggleRaw(true);
-      if (!readSerialChar()) {
-        cmd_error = AT_ERR_BAD_BYTE;
-        cmd_parsing = AT_PARSE_ERROR;
+  cmd_result_ok = false;
+  cmd_crc_found = false;
+  info_match = AT_MATCH_NONE;
+  info_offset = 0;
+  idle_match = AT_MATCH_NONE;
+  echo_skipped = 0;
+  echo_missed = echo;
+  result_offset = rx_buffer_size;
+  matcher.setEcho(commandPtr(), AT_MATCH_ECHO, AT_CR);
+  matcher.reset();
+  cmd_deadline = millis() + timeout_ms;
+  cmd_pending = true;
+}
+
+bool AtClientBase::parseResponse() {
+  while (rxAvailable() > 0 && cmd_parsing < AT_PARSE_OK) {
+    if (line_sink != nullptr && isRxBufferFull() &&
+        cmd_parsing == AT_PARSE_RESPONSE)
+      sinkLine(false);   // pass on the part of an overlong line received
+    toggleRaw(true);
+    uint8_t match = AT_MATCH_NONE;
+    if (!readSerialMatch(match)) {
+      cmd_error = AT_ERR_BAD_BYTE;
+      cmd_parsing = AT_PARSE_ERROR;
+      toggleRaw(false);
+      AR_LOGE("Bad byte received in response");
+      break;
+    }
+    char last = lastCharRead();
+    last_rx_us = micros();
+    if (idle_match != AT_MATCH_NONE) {
+      // the line did not go idle: a candidate is only final if CRC follows
+      uint8_t candidate = idle_match;
+      idle_match = AT_MATCH_NONE;
+      if (candidate != AT_MATCH_ERROR && last == CRC_SEP && rx_len == idle_end + 1) {
         toggleRaw(false);
-        AR_LOGE("Bad byte received in response");
-        break;
+        cmd_parsing = parsingShort(candidate == AT_MATCH_SHORT_OK);
+      } else if (candidate != AT_MATCH_ERROR) {
+        result_offset = rx_buffer_size;
       }
-      char last = lastCharRead();
-      if (last == AT_LF) {
-        // unsolicited, V0 info-suffix/multiline sep, V1 prefix/multiline/suffix
-        char* res = responsePtr();
-        if (cmd_parsing == AT_PARSE_ECHO || !startsWith(res, terminator)) {
-          // check if V0 info suffix or multiline separator
-          if (lastCharRead(2) != AT_CR) {
-            toggleRaw(false);
-#ifndef ARDEBUG_DISABLED
-            AR_LOGW("Unexpected response data removed: %s",
-                debugString(res).c_str());
-#endif
-            clearRxBuffer();
-          }
-        }
-        if (endsWith(res, vres_ok)) {
-          toggleRaw(false);
-          cmd_parsing = parsingOk();
-          verbose = true;
-        } else if (endsWith(res, vres_err) || startsWith(res, cme_err)) {
-          toggleRaw(false);
-          cmd_parsing = parsingError();
-          verbose = true;
-        } else if (cmd_parsing == AT_PARSE_CRC) {
-          toggleRaw(false);
-          AR_LOGV("CRC parsing complete");
-          if (!cmd_result_ok) {
-            cmd_parsing = AT_PARSE_ERROR;
-          } else {
-            if (validateCrc(res)) {
-              cmd_parsing = AT_PARSE_OK;
-            } else {
-              AR_LOGW("Invalid CRC");
-              cmd_parsing = AT_PARSE_ERROR;
-              cmd_error = AT_ERR_CMD_CRC;
-              cmd_result_ok = false;
-            }
-          }
-        }   // else intermediate line formatter - keep parsing
-      } else if (last == AT_CR) {
-        char* res = responsePtr();
-        if (endsWith(res, commandPtr())) {
-          toggleRaw(false);
-#ifndef ARDEBUG_DISABLED
-          if (!startsWith(res, commandPtr())) {
-            String xtra = debugString(res, 0, strlen(res) - strlen(commandPtr()));
-            AR_LOGW("Unexpected pre-echo data removed: %s", xtra.c_str());
-          }
-          AR_LOGV("Echo received - clearing RX buffer: %s", sDbgRes().c_str());
-#endif
-          clearRxBuffer();   // remove echo from response
-          cmd_parsing = AT_PARSE_RESPONSE;
+    }
+    if (match == AT_MATCH_ECHO && cmd_parsing == AT_PARSE_ECHO) {
+      toggleRaw(false);
+      // the echo ends the buffer, consume it and anything before in place
+      echo_skipped += rxMatchOffset();
+      if (echo_skipped > 0)
+        AR_LOGW("Unexpected pre-echo data removed (%u bytes)",
+                (unsigned)echo_skipped);
+      AR_LOGV("Echo received");
+      rx_len = 0;
+      line_start = 0;
+      responsePtr()[0] = '\0';
+      matcher.reset();
+      echo_missed = false;
+      cmd_parsing = AT_PARSE_RESPONSE;
+    } else if (match == AT_MATCH_OK) {
+      toggleRaw(false);
+      result_offset = rxMatchOffset();
+      cmd_parsing = parsingOk();
+      verbose = true;
+    } else if (match == AT_MATCH_ERROR) {
+      toggleRaw(false);
+      result_offset = rxMatchOffset();
+      cmd_parsing = parsingError();
+      verbose = true;
+    } else if (match == AT_MATCH_CME) {
+      info_match = match;   // error information follows to end of line
+      info_offset = rx_len;
+    } else if (match >= AT_MATCH_USER) {
+      const AtResultCode& code = result_codes[match - AT_MATCH_USER];
+      if (code.kind == AT_RESULT_LINE) {
+        info_match = match;
+        info_offset = rx_len;
+      } else {
+        toggleRaw(false);
+        result_offset = rxMatchOffset();
+        cmd_parsing = parsingResult(code);
+      }
+    } else if (last == AT_LF) {
+      // unsolicited, V0 info-suffix/multiline sep, V1 prefix/multiline/suffix
+      char* res = responsePtr();
+      if (info_match == AT_MATCH_CME) {
+        toggleRaw(false);
+        cmd_parsing = parsingError();
+        verbose = true;
+      } else if (info_match >= AT_MATCH_USER) {
+        toggleRaw(false);
+        cmd_parsing = parsingResult(result_codes[info_match - AT_MATCH_USER]);
+      } else if (data_header != nullptr && cmd_parsing == AT_PARSE_RESPONSE &&
+                 strncmp(&res[line_start], data_header,
+                         strlen(data_header)) == 0) {
+        toggleRaw(false);
+        readPayload(&res[line_start]);
+        matcher.reset();
+      } else if (cmd_parsing <= AT_PARSE_RESPONSE && urc_handler_count > 0 &&
+                 queueUrc(&res[line_start], rx_len - line_start)) {
+        rx_len = line_start;   // demultiplexed - remove from the response
+        res[rx_len] = '\0';
+      } else if (line_sink != nullptr && cmd_parsing == AT_PARSE_RESPONSE) {
+        sinkLine(true);
+      } else if (cmd_parsing == AT_PARSE_CRC) {
+        toggleRaw(false);
+        AR_LOGV("CRC parsing complete");
+        if (!cmd_result_ok) {
+          cmd_parsing = AT_PARSE_ERROR;
         } else {
-          int old_parsing = cmd_parsing;
-          char p = serial.peek();
-          if (p == -1 || p == CRC_SEP) {
-            toggleRaw(false);
-            cmd_parsing = parsingShort(cmd_parsing);
+          if (validateCrc(res)) {
+            cmd_parsing = AT_PARSE_OK;
+          } else {
+            AR_LOGW("Invalid CRC");
+            cmd_parsing = AT_PARSE_ERROR;
+            cmd_error = AT_ERR_CMD_CRC;
+            cmd_result_ok = false;
           }
         }
-      } else if (last == CRC_SEP && cmd_parsing == AT_PARSE_CRC) {
-        cmd_crc_found = true;
-      }
-    }   // parsed available char
-    if (cmd_parsing >= AT_PARSE_OK) {
-      toggleRaw(false);
-      break;   // don't wait for timeout
-    }
-    if (tick > 0 && strlen(responsePtr()) == 0) {
-      if ((millis() - start) / 1000 >= tick) {
-        tick++;
-        countdown--;
+      } else if (lastCharRead(2) != AT_CR &&
+                 (cmd_parsing == AT_PARSE_ECHO || !rxStartsWith(terminator))) {
+        // not a V0 info suffix or multiline separator
         toggleRaw(false);
-        AR_LOGV("[%d] Countdown: %d", millis(), countdown);
-      }
+#ifndef ARDEBUG_DISABLED
+        AR_LOGW("Unexpected response data removed: %s",
+            debugString(res).c_str());
+#endif
+        if (cmd_parsing == AT_PARSE_ECHO)
+          echo_skipped += rx_len;
+        clearRxBuffer();
+        matcher.reset();
+      }   // else intermediate line formatter - keep parsing
+      line_start = rx_len;
+    } else if ((match == AT_MATCH_SHORT_OK || match == AT_MATCH_SHORT_ERROR) &&
+               cmd_parsing < AT_PARSE_CRC &&
+               (rx_len == matcher.matchLength() ||
+                lastCharRead(matcher.matchLength() + 1) == AT_LF)) {
+      // final only if the line goes idle or a CRC follows
+      result_offset = rxMatchOffset();
+      idle_match = match;
+      idle_end = rx_len;
+    } else if (last == CRC_SEP && cmd_parsing == AT_PARSE_CRC) {
+      cmd_crc_found = true;
     }
-  }   // parsing timeout loop
+  }   // parsed available char
+  while (idle_match != AT_MATCH_NONE && rxAvailable() == 0 && lineIdle()) {
+    uint8_t candidate = idle_match;
+    idle_match = AT_MATCH_NONE;
+    toggleRaw(false);
+    if (candidate == AT_MATCH_ERROR)
+      cmd_parsing = AT_PARSE_ERROR;   // no CRC followed
+    else
+      cmd_parsing = parsingShort(candidate == AT_MATCH_SHORT_OK);
+  }
+  if (cmd_parsing >= AT_PARSE_OK) {
+    toggleRaw(false);
+    return true;   // don't wait for timeout
+  }
+  return deadlinePassed(cmd_deadline);
+}
+
+at_error_t AtClientBase::finishResponse() {
   toggleRaw(false);
+#ifndef ARDEBUG_DISABLED
+  if (echo_missed)
+    AR_LOGD("No echo received for %s", sDbgReq().c_str());
+#endif
   if (cmd_parsing < AT_PARSE_OK) {
     if (cmd_result_ok) {
-      if (verbose && endsWith(responsePtr(), "\r")) {
+      if (verbose && lastCharRead() == AT_CR) {
         AR_LOGI("Detected non-verbose");
         if (autoflag) verbose = false;
       } else if (crc && !cmd_crc_found) {
@@ -298,17 +794,18 @@ at_error_t AtClient::readAtResponse(uint16_t timeout_ms) {
       AR_LOGW("CRC detected but not expected");
       crc = true;
       cmd_error = AT_ERR_CRC_CONFIG;
-    } else if (startsWith(responsePtr(), cme_err)) {
-      const size_t cme_errno_buffer = 24;
-      if (strlen(responsePtr()) < cme_errno_buffer) {
-        char tmp[cme_errno_buffer];
-        strncpy(tmp, responsePtr(), cme_errno_buffer);
-        replace(tmp, cme_err, "", cme_errno_buffer);
-        if (isNumber(tmp)) {
-          AR_LOGD("Found CME ERROR code - clearing response buffer");
-          cmd_error = atoi(tmp);
-          clearRxBuffer();
-        }
+    } else if (info_match >= AT_MATCH_USER) {
+      response_ready = true;   // Result information available to retrieve
+    } else if (info_match == AT_MATCH_CME) {
+      char* info = responsePtr() + info_offset;
+      char* end = nullptr;
+      long cme_errno = strtol(info, &end, 10);
+      while (end != info && (*end == ' ' || *end == AT_CR || *end == AT_LF))
+        end++;
+      if (end != info && *end == '\0') {
+        AR_LOGD("Found CME ERROR code - clearing response buffer");
+        cmd_error = (at_error_t)cme_errno;
+        clearRxBuffer();
       } else {
         response_ready = true; // Verbose response available to retrieve
 #ifndef ARDEBUG_DISABLED
@@ -320,7 +817,8 @@ at_error_t AtClient::readAtResponse(uint16_t timeout_ms) {
     }
   } else {
     response_ready = true;
-    cmd_error = AT_OK;
+    if (info_match < AT_MATCH_USER)
+      cmd_error = AT_OK;
   }
 #ifndef ARDEBUG_DISABLED
   AR_LOGV("Parsing complete (error code %d) - clearing pending command: %s",
@@ -328,16 +826,47 @@ at_error_t AtClient::readAtResponse(uint16_t timeout_ms) {
   if (response_ready) AR_LOGV("Response: %s", sDbgRes().c_str());
 #endif
   clearPendingCommand();
+  cmd_pending = false;
   return cmd_error;
 }
 
-at_error_t AtClient::lastErrorCode(bool clear) {
+bool AtClientBase::addResultCode(const char* pattern, at_error_t error,
+                             uint8_t kind) {
+  if (strlen(pattern) == 0 || strlen(pattern) >= AT_RESULT_CODE_SIZE ||
+      result_code_count >=
+          matcher.capacity() - AT_MATCHER_BUILTIN_PATTERNS) {
+    AR_LOGE("Unable to register result code %s", pattern);
+    return false;
+  }
+  AtResultCode& code = result_codes[result_code_count];
+  strncpy(code.pattern, pattern, AT_RESULT_CODE_SIZE);
+  code.error = error;
+  code.kind = kind;
+  if (!matcher.add(code.pattern, AT_MATCH_USER + result_code_count)) {
+    AR_LOGE("Result code matcher full");
+    return false;
+  }
+  result_code_count++;
+  return matcher.compile();
+}
+
+void AtClientBase::clearResultCodes() {
+  result_code_count = 0;
+  matcher.clear();
+  matcher.add(vres_ok, AT_MATCH_OK);
+  matcher.add(vres_err, AT_MATCH_ERROR);
+  matcher.add(cme_err, AT_MATCH_CME);
+  matcher.add(res_ok, AT_MATCH_SHORT_OK);
+  matcher.add(res_err, AT_MATCH_SHORT_ERROR);
+}
+
+at_error_t AtClientBase::lastErrorCode(bool clear) {
   at_error_t last = cmd_error;
   if (clear) cmd_error = AT_OK;
   return last;
 }
 
-parse_state_t AtClient::parsingOk() {
+parse_state_t AtClientBase::parsingOk() {
   parse_state_t next_state = AT_PARSE_OK;
   cmd_result_ok = true;
 #ifndef ARDEBUG_DISABLED
@@ -345,16 +874,14 @@ parse_state_t AtClient::parsingOk() {
   AR_LOGV("Assessing pending command for CRC toggle: %s", sDbgReq().c_str());
 #endif
   if (!this->crc) {
-    if (includes(commandPtr(), (const char*)"CRC=1\r") ||
-        includes(commandPtr(), (const char*)"crc=1\r")) {
+    if (endsWith(commandPtr(), "CRC=1") || endsWith(commandPtr(), "crc=1")) {
       AR_LOGI("CRC enabled by pending command - set flag");
       this->crc = true;
       next_state = AT_PARSE_CRC;
     }
   } else {
-    if ((includes(commandPtr(), (const char*)"CRC=0\r") ||
-        includes(commandPtr(), (const char*)"crc=0\r")) ||
-        includes(commandPtr(), 'Z') && serial.available() == 0) {
+    if ((endsWith(commandPtr(), "CRC=0") || endsWith(commandPtr(), "crc=0")) ||
+        includes(commandPtr(), 'Z') && rxAvailable() == 0) {
       AR_LOGI("CRC disabled by pending command - clear flag");
       this->crc = false;
     } else {
@@ -367,81 +894,208 @@ parse_state_t AtClient::parsingOk() {
   return next_state;
 }
 
-parse_state_t AtClient::parsingError() {
+parse_state_t AtClientBase::parsingError() {
   parse_state_t next_state = AT_PARSE_ERROR;
   AR_LOGE("Result ERROR");
-  delay(AT_CHAR_DELAY_MS);
-  if (this->crc || serial.available() > 0) {
-    next_state = AT_PARSE_CRC;
-    AR_LOGV("Parsing CRC...");
+  if (!this->crc) {
+    // a CRC may follow even if not configured: final once the line is idle
+    idle_match = AT_MATCH_ERROR;
+    idle_end = rx_len;
   }
+  next_state = AT_PARSE_CRC;
+  AR_LOGV("Parsing CRC...");
   return next_state;
 }
 
-parse_state_t AtClient::parsingShort(uint8_t current) {
-  parse_state_t next_state = current;
+parse_state_t AtClientBase::parsingResult(const AtResultCode& code) {
+#ifndef ARDEBUG_DISABLED
+  AR_LOGD("Result %s (error code %d)", debugString(code.pattern).c_str(),
+      code.error);
+#endif
+  cmd_error = code.error;
+  if (code.kind == AT_RESULT_PROMPT)
+    return code.error == AT_OK ? AT_PARSE_OK : AT_PARSE_ERROR;
+  return code.error == AT_OK ? parsingOk() : parsingError();
+}
+
+parse_state_t AtClientBase::parsingShort(bool ok) {
   AR_LOGV("Checking candidate short response code");
-  char* res = responsePtr();
-  if (!startsWith(res, terminator)) {
-    if (verbose) {
-      AR_LOGW("Short response code found");
-      if (autoflag) verbose = false;
-    }
-    if (endsWith(res, res_ok)) {
-      next_state = parsingOk();
-    } else {
-      next_state = parsingError();
-    }
+  if (rxStartsWith(terminator))
+    return cmd_parsing;
+  if (verbose) {
+    AR_LOGW("Short response code found");
+    if (autoflag) verbose = false;
   }
-  return next_state;
+  return ok ? parsingOk() : parsingError();
 }
 
-void AtClient::cleanResponse(const char *prefix) {
-  if (strlen(responsePtr()) == 0) {
+void AtClientBase::cleanResponse(const char *prefix) {
+  if (rx_len == 0) {
     AR_LOGD("No response to clean");
     return;
   }
-  if (crc) {
-    AR_LOGV("Removing CRC");
-    unsigned short int crc_length = 1 + CRC_LEN + strlen(terminator);
-    size_t crc_offset = strlen(responsePtr()) - crc_length;
-    remove(responsePtr(), crc_offset, crc_length);
+  char* buf = responsePtr();
+  size_t end = rx_len;
+  if (!rx_clean) {
+    if (result_offset < end) {
+      AR_LOGV("Removing result code and CRC");
+      end = result_offset;   // CRC (if any) follows the result code
+    } else if (crc) {
+      AR_LOGV("Removing CRC");
+      size_t crc_length = 1 + CRC_LEN + strlen(terminator);
+      end = end > crc_length ? end - crc_length : 0;
+    }
   }
-  const char* to_remove = this->verbose ? vres_ok : res_ok;
-#ifndef ARDEBUG_DISABLED
-  AR_LOGV("Removing result code: %s", debugString(to_remove).c_str());
-#endif
-  replace(responsePtr(), to_remove, "", rx_buffer_size);
-  if (prefix != nullptr && strcmp(prefix, "") != 0) {
+  size_t prefix_len = (prefix != nullptr) ? strlen(prefix) : 0;
+  if (prefix_len > 0)
     AR_LOGV("Removing prefix: %s", prefix);
-    replace(responsePtr(), prefix, "", rx_buffer_size);
+  // single forward pass, compacting lines in place since out <= pos always
+  size_t out = 0;
+  size_t pos = 0;
+  while (pos < end) {
+    const char* lf = (const char*)memchr(&buf[pos], AT_LF, end - pos);
+    size_t stop = (lf != nullptr) ? (size_t)(lf - buf) : end;
+    size_t next = (lf != nullptr) ? stop + 1 : end;
+    size_t start = pos;
+    if (out == 0) {
+      while (start < stop && isspace((unsigned char)buf[start]))
+        start++;
+    }
+    if (prefix_len > 0 && stop - start >= prefix_len &&
+        strncmp(&buf[start], prefix, prefix_len) == 0) {
+      start += prefix_len;
+      while (start < stop && buf[start] == ' ')
+        start++;
+    }
+    while (stop > start && buf[stop - 1] == AT_CR)
+      stop--;
+    if (stop > start) {
+      if (out > 0)
+        buf[out++] = AT_LF;
+      memmove(&buf[out], &buf[start], stop - start);
+      out += stop - start;
+    }
+    pos = next;
   }
-  trim(responsePtr(), rx_buffer_size);
-  replace(responsePtr(), "\r\n", "\n", rx_buffer_size);
-  replace(responsePtr(), "\n\n", "\n", rx_buffer_size);
+  while (out > 0 && isspace((unsigned char)buf[out - 1]))
+    out--;
+  buf[out] = '\0';
+  rx_len = out;
+  rx_clean = true;
+  result_offset = rx_len;
 #ifndef ARDEBUG_DISABLED
   AR_LOGV("Trimmed and consolidated line feeds: %s", sDbgRes().c_str());
 #endif
 }
 
+/**
+ * @brief Get the bytes waiting in the read-ahead chunk, draining whatever the
+ * serial port has available in a single read when the chunk is empty
+*/
+size_t AtClientBase::rxAvailable() {
+  if (chunk_pos >= chunk_len) {
+    chunk_pos = 0;
+    chunk_len = 0;
+    int waiting = serial.available();
+    if (waiting > 0) {
+      size_t to_read = (size_t)waiting < sizeof(rx_chunk) ?
+                       (size_t)waiting : sizeof(rx_chunk);
+      chunk_len = serial.readBytes(rx_chunk, to_read);
+    }
+  }
+  return chunk_len - chunk_pos;
+}
+
+int AtClientBase::rxPeek() {
+  if (rxAvailable() == 0)
+    return -1;
+  return (uint8_t)rx_chunk[chunk_pos];
+}
+
 /**
  * @brief Attempts to read the next serial character
  * @returns false if character is invalid else true (success or no data)
 */
-bool AtClient::readSerialChar(bool ignore_unprintable) {
-  bool success = serial.available() == 0;
-  if (serial.available() > 0) {
+bool AtClientBase::readSerialChar(bool ignore_unprintable) {
+  bool success = rxAvailable() == 0;
+  if (!success) {
     if (!isRxBufferFull()) {
-      char c = serial.read();
+      char c = rx_chunk[chunk_pos++];
       if (printableChar(c, ardebugGetLevel() > ARDEBUG_D) || ignore_unprintable) {
         success = true;
-        size_t index = strlen(responsePtr());
-        responsePtr()[index] = c;
-        responsePtr()[index + 1] = '\0';
+        responsePtr()[rx_len++] = c;
+        responsePtr()[rx_len] = '\0';
       }
     }
   }
   return success;
 }
 
+/**
+ * @brief Reads from the read-ahead chunk into the Rx buffer, advancing the
+ * response matcher per character. Stops after a match, a `<cr>`, `<lf>` or
+ * CRC separator, or when the chunk is exhausted.
+ * @param match Set to the matcher tag of the last character read
+ * @returns false if an invalid character was read or the buffer is full
+*/
+bool AtClientBase::readSerialMatch(uint8_t& match) {
+  char* buf = responsePtr();
+  bool trace = ardebugGetLevel() > ARDEBUG_D;
+  size_t end = chunk_pos + rxAvailable();
+  while (chunk_pos < end) {
+    char c = rx_chunk[chunk_pos];
+    bool plain = c >= 32 && c <= 125;
+    if (!plain && !printableChar(c, trace)) {
+      chunk_pos++;
+      return false;
+    }
+    if (isRxBufferFull()) {
+      if (line_sink != nullptr)
+        break;   // the caller passes the line on to make room
+      return false;
+    }
+    if (plain && trace)
+      printableChar(c, true);
+    chunk_pos++;
+    buf[rx_len++] = c;
+    match = matcher.feed(c);
+    if (match != AT_MATCH_NONE || !plain || c == CRC_SEP)
+      break;
+  }
+  buf[rx_len] = '\0';
+  return true;
+}
+
+/**
+ * @brief Copies the run of plain printable characters at the head of the
+ * read-ahead chunk into the Rx buffer, stopping at the first `<cr>`, `<lf>`,
+ * CRC separator or unprintable byte, which are left for `readSerialChar`
+ * @returns The number of characters copied
+*/
+size_t AtClientBase::readSerialText() {
+  size_t end = chunk_pos + rxAvailable();
+  size_t room = rx_buffer_size - 1 - rx_len;
+  if (end - chunk_pos > room)
+    end = chunk_pos + room;
+  size_t run_end = chunk_pos;
+  while (run_end < end) {
+    char c = rx_chunk[run_end];
+    if (c < 32 || c > 125 || c == CRC_SEP)
+      break;
+    run_end++;
+  }
+  size_t count = run_end - chunk_pos;
+  if (count > 0) {
+    if (ardebugGetLevel() > ARDEBUG_D) {
+      for (size_t i = chunk_pos; i < run_end; i++)
+        printableChar(rx_chunk[i], true);
+    }
+    memcpy(responsePtr() + rx_len, rx_chunk + chunk_pos, count);
+    rx_len += count;
+    responsePtr()[rx_len] = '\0';
+    chunk_pos = run_end;
+  }
+  return count;
+}
+
 }   // namespace at
\ No newline at end of file
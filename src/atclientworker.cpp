@@ -0,0 +1,146 @@
+#include "atclientworker.h"
+
+#if !defined(__AVR__)
+
+namespace at {
+
+AtClientWorker::AtClientWorker(AtClientBase& client, size_t max_queue,
+                               uint32_t idle_ms)
+    : client(client), max_queue(max_queue > 0 ? max_queue : 1),
+      idle_ms(idle_ms) {}
+
+AtClientWorker::~AtClientWorker() {
+  stop();
+}
+
+void AtClientWorker::start() {
+  std::lock_guard<std::mutex> guard(lock);
+  if (running)
+    return;
+  running = true;
+  worker = std::thread(&AtClientWorker::run, this);
+}
+
+void AtClientWorker::stop() {
+  {
+    std::lock_guard<std::mutex> guard(lock);
+    if (!running)
+      return;
+    running = false;
+  }
+  request_ready.notify_all();
+  space_ready.notify_all();
+  if (worker.joinable())
+    worker.join();
+}
+
+bool AtClientWorker::onWorker() {
+  std::lock_guard<std::mutex> guard(lock);
+  return std::this_thread::get_id() == worker.get_id();
+}
+
+bool AtClientWorker::enqueue(Request&& request) {
+  std::unique_lock<std::mutex> guard(lock);
+  if (std::this_thread::get_id() == worker.get_id() &&
+      requests.size() >= max_queue) {
+    // the worker would wait on itself to make room
+    AR_LOGE("Worker queue full - command from worker thread rejected");
+    return false;
+  }
+  space_ready.wait(guard, [this]() {
+    return !running || requests.size() < max_queue;
+  });
+  if (!running) {
+    AR_LOGW("Worker not running - command rejected");
+    return false;
+  }
+  requests.push_back(std::move(request));
+  guard.unlock();
+  request_ready.notify_one();
+  return true;
+}
+
+std::future<AtResult> AtClientWorker::submit(const char* at_command,
+                                             uint32_t timeout_ms,
+                                             const char* prefix) {
+  Request request;
+  request.command = at_command;
+  request.prefix = prefix != nullptr ? prefix : "";
+  request.timeout_ms = timeout_ms;
+  request.callback = nullptr;
+  request.context = nullptr;
+  std::future<AtResult> result = request.promise.get_future();
+  if (!enqueue(std::move(request))) {
+    std::promise<AtResult> rejected;
+    rejected.set_value(AtResult{ AT_ERR_BUSY, "" });
+    return rejected.get_future();
+  }
+  return result;
+}
+
+bool AtClientWorker::submit(const char* at_command, at_worker_cb_t callback,
+                            void* context, uint32_t timeout_ms,
+                            const char* prefix) {
+  Request request;
+  request.command = at_command;
+  request.prefix = prefix != nullptr ? prefix : "";
+  request.timeout_ms = timeout_ms;
+  request.callback = callback;
+  request.context = context;
+  return enqueue(std::move(request));
+}
+
+AtResult AtClientWorker::sendAtCommand(const char* at_command,
+                                       uint32_t timeout_ms,
+                                       const char* prefix) {
+  if (onWorker()) {
+    // the result could only be produced by the thread that would wait for it
+    AR_LOGE("sendAtCommand from a worker callback - use submit");
+    return AtResult{ AT_ERR_BUSY, "" };
+  }
+  return submit(at_command, timeout_ms, prefix).get();
+}
+
+size_t AtClientWorker::queued() {
+  std::lock_guard<std::mutex> guard(lock);
+  return requests.size();
+}
+
+void AtClientWorker::run() {
+  std::unique_lock<std::mutex> guard(lock);
+  while (running || !requests.empty()) {
+    if (requests.empty()) {
+      request_ready.wait_for(guard, std::chrono::milliseconds(idle_ms));
+      if (requests.empty()) {
+        guard.unlock();
+        while (client.dispatchUrc()) {}
+        guard.lock();
+        continue;
+      }
+    }
+    Request request = std::move(requests.front());
+    requests.pop_front();
+    guard.unlock();
+    space_ready.notify_one();
+    AtResult result;
+    // 0 would leave the command pending in the client, awaiting a poll
+    uint16_t timeout_ms = request.timeout_ms == 0 ? AT_TIMEOUT_MS :
+                          request.timeout_ms > 0xFFFF ?
+                          0xFFFF : (uint16_t)request.timeout_ms;
+    result.error = client.sendAtCommand(request.command.c_str(), timeout_ms);
+    if (result.error == AT_OK) {
+      const char* prefix = request.prefix.length() > 0 ?
+                           request.prefix.c_str() : nullptr;
+      result.response = client.sgetResponse(prefix);
+    }
+    if (request.callback != nullptr)
+      request.callback(result, request.context);
+    else
+      request.promise.set_value(std::move(result));
+    guard.lock();
+  }
+}
+
+}   // namespace at
+
+#endif   // __AVR__
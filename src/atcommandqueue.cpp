@@ -0,0 +1,71 @@
+#include "atcommandqueue.h"
+
+namespace at {
+
+bool AtCommandQueue::submit(AtQueuedCommand* commands, size_t count,
+                            bool stop_on_error) {
+  if (busy() || client.commandPending()) {
+    AR_LOGW("Command queue busy");
+    return false;
+  }
+  for (size_t i = 0; i < count; i++)
+    commands[i].error = AT_PENDING;
+  batch = commands;
+  batch_size = count;
+  next = 0;
+  result = AT_OK;
+  this->stop_on_error = stop_on_error;
+  if (!sendNext())
+    poll();   // record the failure and carry on or stop
+  return true;
+}
+
+bool AtCommandQueue::sendNext() {
+  if (next >= batch_size) {
+    batch = nullptr;
+    return true;
+  }
+  AtQueuedCommand& cmd = batch[next];
+  return client.submitAtCommand(cmd.command, cmd.timeout_ms);
+}
+
+at_error_t AtCommandQueue::poll() {
+  while (busy()) {
+    at_error_t error = client.commandPending() ? client.poll() :
+                                                 client.lastErrorCode();
+    if (error == AT_PENDING)
+      return AT_PENDING;
+    AtQueuedCommand& cmd = batch[next];
+    cmd.error = error;
+    if (error != AT_OK && result == AT_OK)
+      result = error;
+    if (cmd.handler != nullptr) {
+      if (client.responseReady()) client.cleanResponse();
+      cmd.handler(next, error, client.responseReady() ? client.responsePtr() : "");
+    }
+    next++;
+    if (error != AT_OK && stop_on_error) {
+      AR_LOGW("Command queue stopped at %u of %u", (unsigned)next,
+              (unsigned)batch_size);
+      batch = nullptr;
+      break;
+    }
+    sendNext();   // failure to send is picked up by the next iteration
+  }
+  return result;
+}
+
+at_error_t AtCommandQueue::run() {
+  at_error_t error = poll();
+  while (error == AT_PENDING) {
+    client.waitForRx(client.cmd_deadline);
+    error = poll();
+  }
+  return error;
+}
+
+void AtCommandQueue::cancel() {
+  batch = nullptr;
+}
+
+}   // namespace at
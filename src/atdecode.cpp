@@ -0,0 +1,53 @@
+#include "atdecode.h"
+
+namespace at {
+
+static int digitValue(char c) {
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  if (c >= 'A' && c <= 'Z')
+    return c - 'A' + 10;
+  if (c >= 'a' && c <= 'z')
+    return c - 'a' + 10;
+  return -1;
+}
+
+bool parseUint(const AtSpan& span, unsigned long& value, uint8_t base) {
+  if (span.len == 0 || base < 2 || base > 36)
+    return false;
+  const unsigned long max = std::numeric_limits<unsigned long>::max();
+  unsigned long result = 0;
+  for (size_t i = 0; i < span.len; i++) {
+    int digit = digitValue(span.ptr[i]);
+    if (digit < 0 || digit >= base)
+      return false;
+    if (result > (max - digit) / base)
+      return false;   // overflow
+    result = result * base + digit;
+  }
+  value = result;
+  return true;
+}
+
+bool parseInt(const AtSpan& span, long& value, uint8_t base) {
+  if (span.len == 0)
+    return false;
+  bool negative = span.ptr[0] == '-';
+  AtSpan digits = span;
+  if (negative || span.ptr[0] == '+') {
+    digits.ptr++;
+    digits.len--;
+  }
+  unsigned long magnitude;
+  if (!parseUint(digits, magnitude, base))
+    return false;
+  const unsigned long limit = negative ?
+      (unsigned long)std::numeric_limits<long>::max() + 1 :
+      (unsigned long)std::numeric_limits<long>::max();
+  if (magnitude > limit)
+    return false;
+  value = negative ? (long)(0 - magnitude) : (long)magnitude;
+  return true;
+}
+
+}   // namespace at
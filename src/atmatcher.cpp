@@ -0,0 +1,125 @@
+#include "atmatcher.h"
+
+namespace at {
+
+#define AT_MATCHER_NO_NODE 0xFFFF   // pattern cursor once the trie is full
+
+void AtMatcherBase::clear() {
+  if (max_nodes > 0)
+    nodes[0] = { 0, 0, 0, 0, 0, 0 };
+  node_count = 1;
+  pattern_count = 0;
+  state = 0;
+  compiled = true;
+}
+
+bool AtMatcherBase::add(const char* pattern, uint8_t tag) {
+  size_t len = strlen(pattern);
+  if (len == 0 || len > 255 || tag == 0 || pattern_count >= max_patterns)
+    return false;
+  patterns[pattern_count] = { pattern, (uint8_t)len, tag, 0 };
+  pattern_count++;
+  compiled = false;
+  return true;
+}
+
+bool AtMatcherBase::compile() {
+  compiled = true;
+  state = 0;
+  if (max_nodes == 0)
+    return pattern_count == 0;
+  nodes[0] = { 0, 0, 0, 0, 0, 0 };
+  node_count = 1;
+  bool success = true;
+  // insert one level of every pattern at a time, so nodes are numbered
+  // breadth-first and the failure links resolve in index order, no queue
+  for (uint8_t i = 0; i < pattern_count; i++)
+    patterns[i].node = 0;
+  bool deeper = true;
+  for (uint16_t depth = 0; deeper; depth++) {
+    deeper = false;
+    for (uint8_t i = 0; i < pattern_count; i++) {
+      Pattern& p = patterns[i];
+      if (p.node == AT_MATCHER_NO_NODE || depth >= p.len)
+        continue;
+      uint16_t next = childOf(p.node, p.str[depth]);
+      if (next == 0) {
+        if (node_count >= max_nodes) {
+          p.node = AT_MATCHER_NO_NODE;
+          success = false;
+          continue;
+        }
+        next = node_count++;
+        nodes[next] = { p.str[depth], 0, 0, nodes[p.node].child, 0, 0 };
+        nodes[p.node].child = next;
+      }
+      p.node = next;
+      if (depth + 1 < p.len)
+        deeper = true;
+      else if (nodes[next].pattern == 0)
+        nodes[next].pattern = i + 1;
+    }
+  }
+  // children of the root fail to the root, as initialised
+  for (uint16_t node = 1; node < node_count; node++) {
+    for (uint16_t n = nodes[node].child; n != 0; n = nodes[n].sibling) {
+      uint16_t f = nodes[node].fail;
+      uint16_t target = childOf(f, nodes[n].c);
+      while (target == 0 && f != 0) {
+        f = nodes[f].fail;
+        target = childOf(f, nodes[n].c);
+      }
+      nodes[n].fail = target;
+      nodes[n].output = nodes[target].pattern != 0 ?
+                        target : nodes[target].output;
+    }
+  }
+  return success;
+}
+
+void AtMatcherBase::setEcho(const char* pattern, uint8_t tag, char suffix) {
+  echo = pattern;
+  echo_suffix = suffix;
+  echo_len = pattern != nullptr ? strlen(pattern) : 0;
+  if (echo_len > 0 && suffix != '\0')
+    echo_len++;
+  echo_pos = 0;
+  echo_tag = tag;
+}
+
+/**
+ * @brief Get the echo cursor after a mismatch, as the longest echo prefix
+ * ending the text matched so far plus `c` (the echo may overlap itself
+ * e.g. `AAB` in `AAAB`). Rescans in place as the echo has no failure table;
+ * only noise ahead of the echo takes this path.
+ */
+size_t AtMatcherBase::echoFallback(char c) const {
+  for (size_t k = echo_pos; k > 0; k--) {
+    if (echo[k - 1] == c &&
+        memcmp(echo, echo + echo_pos - k + 1, k - 1) == 0)
+      return k;
+  }
+  return 0;
+}
+
+uint8_t AtMatcherBase::matchPrefix(const char* str, size_t len) {
+  if (!compiled)
+    compile();
+  if (max_nodes == 0)
+    return 0;
+  uint8_t tag = 0;
+  uint16_t node = 0;
+  for (size_t i = 0; i < len; i++) {
+    node = childOf(node, str[i]);
+    if (node == 0)
+      break;
+    if (nodes[node].pattern != 0) {
+      const Pattern& p = patterns[nodes[node].pattern - 1];
+      match_len = p.len;
+      tag = p.tag;
+    }
+  }
+  return tag;
+}
+
+}   // namespace at
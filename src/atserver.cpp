@@ -1,8 +1,86 @@
 #include "atserver.h"
+#include <algorithm>
 
 namespace at {
 
-bool AtServer::handleCommand() {
+/**
+ * @brief Order a command name against the first `len` characters of a
+ * request, as `strcmp` would if the request were terminated after `len`
+ */
+static int compareName(const char* name, const char* req, size_t len) {
+  int cmp = strncmp(name, req, len);
+  if (cmp != 0)
+    return cmp;
+  return name[len] == '\0' ? 0 : 1;
+}
+
+const AtCommand* AtServerBase::tableEntry(size_t index) {
+#if defined(__AVR__)
+  memcpy_P(&table_entry, &command_table[index], sizeof(AtCommand));
+  return &table_entry;
+#else
+  return &command_table[index];
+#endif
+}
+
+const AtCommand* AtServerBase::findCommand(const char* name, size_t len) {
+  auto it = std::lower_bound(commands.begin(), commands.end(), name,
+      [len](const AtCommand& cmd, const char* key) {
+        return compareName(cmd.name, key, len) < 0;
+      });
+  if (it != commands.end() && compareName(it->name, name, len) == 0)
+    return &*it;
+  size_t lo = 0;
+  size_t hi = command_table_size;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    const AtCommand* entry = tableEntry(mid);
+    int cmp = compareName(entry->name, name, len);
+    if (cmp == 0)
+      return entry;
+    if (cmp < 0)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return nullptr;
+}
+
+bool AtServerBase::setCommandTable(const AtCommand* table, size_t count) {
+  command_table = table;
+  command_table_size = table != nullptr ? count : 0;
+  // lookups are binary searches, so check the order once up front
+  const char* prev = nullptr;
+  for (size_t i = 0; i < command_table_size; i++) {
+    const char* name = tableEntry(i)->name;
+    if (prev != nullptr && compareName(prev, name, strlen(name)) >= 0) {
+      AR_LOGE("Command table rejected - not sorted at %s", name);
+      command_table = nullptr;
+      command_table_size = 0;
+      return false;
+    }
+    prev = name;
+  }
+  return true;
+}
+
+bool AtServerBase::handleBuiltIn(const char* cmd) {
+  if (strcmp(cmd, "E0") == 0 || strcmp(cmd, "e0") == 0 ||
+      strcmp(cmd, "E1") == 0 || strcmp(cmd, "e1") == 0) {
+    echo = at::endsWith(cmd, "1");
+  } else if (strcmp(cmd, "V0") == 0 || strcmp(cmd, "v0") == 0 ||
+             strcmp(cmd, "V1") == 0 || strcmp(cmd, "v1") == 0) {
+    verbose = at::endsWith(cmd, "1");
+  } else if (at::endsWith(cmd, "CRC=0") || at::endsWith(cmd, "crc=0") ||
+             at::endsWith(cmd, "CRC=1") || at::endsWith(cmd, "crc=1")) {
+    crc = at::endsWith(cmd, "1");
+  } else {
+    return false;
+  }
+  return true;
+}
+
+bool AtServerBase::handleCommand() {
   bool success = false;
   char* req = commandPtr();
   bool crc_valid = (!crc || (crc && at::validateCrc(req)));
@@ -18,8 +96,8 @@ bool AtServer::handleCommand() {
         req[(strlen(req) - 1) - (CRC_LEN + 1)] = '\0';
       }
       const char* attn = at::startsWith(req, "AT") ? "AT" : "at";
-      at::replace(req, attn, "", AT_SERVER_RX_BUFFERSIZE, 1);
-      at::trim(req, AT_SERVER_RX_BUFFERSIZE);
+      at::replace(req, attn, "", rx_buffer_size, 1);
+      at::trim(req, rx_buffer_size);
       int req_count = 1;
       req_count += at::instancesOf((const char*)req, AT_SEP);
       for (int i = 0; i < req_count; ++i) {
@@ -39,49 +117,36 @@ bool AtServer::handleCommand() {
           break;
         }
         at::substring(working_buffer, req, 0, req_length);
-        for (const AtCommand& cmd : commands) {
-          char* cur = &working_buffer[0];
-          success = false;
-          if (strcmp(cur, "E0") == 0 || strcmp(cur, "e0") == 0 ||
-              strcmp(cur, "E1") == 0 || strcmp(cur, "e1") == 0) {
-            echo = at::endsWith(cur, "1") ? true : false;
-            success = true;
-          } else if (strcmp(cur, "V0") == 0 || strcmp(cur, "v0") == 0 ||
-                     strcmp(cur, "V1") == 0 || strcmp(cur, "v1") == 0) {
-            verbose = at::endsWith(cur, "1") ? true : false;
-            success = true;
-          } else if (at::endsWith(cur, "CRC=0") || at::endsWith(cur, "crc=0") ||
-                     at::endsWith(cur, "CRC=1") || at::endsWith(cur, "crc=1")) {
-            crc = at::endsWith(cur, "1") ? true : false;
-            success = true;
-          } else if (at::startsWith(cur, cmd.name)) {
-            if (strlen(cur) == strlen(cmd.name)) {
-              if (cmd.run != nullptr) {
-                cmd.run();
-                success = true;
+        char* cur = &working_buffer[0];
+        success = false;
+        size_t name_len = strcspn(cur, "=?");
+        const AtCommand* cmd = nullptr;
+        if (handleBuiltIn(cur)) {
+          success = true;
+        } else if ((cmd = findCommand(cur, name_len)) != nullptr) {
+          cur += name_len;
+          if (*cur == '\0') {
+            if (cmd->run != nullptr) {
+              cmd->run();
+              success = true;
+            }
+          } else if (*cur == '=') {
+            if (*(cur+1) == '?') {
+              if (cmd->test != nullptr) {
+                cmd->test();
               }
+              success = true;
             } else {
-              cur += strlen(cmd.name);
-              if (*cur == '=') {
-                if (*(cur+1) == '?') {
-                  if (cmd.test != nullptr) {
-                    cmd.test();
-                  }
-                  success = true;
-                } else {
-                  if (cmd.write != nullptr) {
-                    last_error_code = cmd.write((const char*)cur + 1);
-                    success = last_error_code == 0;
-                  }
-                }
-              } else if (*cur == '?') {
-                if (cmd.read != nullptr) {
-                  cmd.read();
-                  success = true;
-                }
+              if (cmd->write != nullptr) {
+                last_error_code = cmd->write((const char*)cur + 1);
+                success = last_error_code == 0;
               }
             }
-            break;
+          } else if (*cur == '?') {
+            if (cmd->read != nullptr) {
+              cmd->read();
+              success = true;
+            }
           }
         }
         if (i < req_count - 1)
@@ -100,25 +165,25 @@ bool AtServer::handleCommand() {
   return success;
 }
 
-bool AtServer::addCommand(AtCommand* new_cmd, bool replace) {
-  int index = -1;
-  for (size_t i = 0; i < commands.size(); ++i) {
-    if (commands[i].name == new_cmd->name) {
-      index = i;
-      break;
-    }
-  }
-  if (index > -1) {
+bool AtServerBase::addCommand(AtCommand* new_cmd, bool replace) {
+  // kept sorted by name so requests are found by binary search
+  auto it = std::lower_bound(commands.begin(), commands.end(), *new_cmd,
+      [](const AtCommand& a, const AtCommand& b) {
+        return strcmp(a.name, b.name) < 0;
+      });
+  if (it != commands.end() && strcmp(it->name, new_cmd->name) == 0) {
     if (!replace)
       return false;
     AR_LOGW("Replacing command %s", new_cmd->name);
-    commands.erase(commands.begin() + index);
+    *it = *new_cmd;
+    return true;
   }
-  commands.push_back(*new_cmd);
+  commands.insert(it, *new_cmd);
   return true;
 }
 
-AtServer::AtServer(Stream& serial) : serial(serial) {
+AtServerBase::AtServerBase(Stream& serial, char* rx_buffer, size_t rx_size)
+    : rx_buffer(rx_buffer), rx_buffer_size(rx_size), serial(serial) {
   snprintf(terminator, 3, "%c%c", AT_CR, AT_LF);
   snprintf(vres_ok, 7, "%sOK%s", terminator, terminator);
   snprintf(vres_err, 10, "%sERROR%s", terminator, terminator);
@@ -126,15 +191,15 @@ AtServer::AtServer(Stream& serial) : serial(serial) {
   snprintf(res_err, 3, "4%c", AT_CR);
 }
 
-at_error_t AtServer::readSerial() {
+at_error_t AtServerBase::readSerial() {
   if (readSerialChar()) {
     char c = lastCharRead();
     if (c == AT_BS) {
       char* cmd = commandPtr();
-      int len = strlen(cmd);
-      cmd[len - 1] = '\0';   // remove the backspace
+      size_t len = rx_len;
+      cmd[--rx_len] = '\0';   // remove the backspace
       if (len > 2)
-        cmd[len - 2] = '\0';   // remove the character prior to backspace
+        cmd[--rx_len] = '\0';   // remove the character prior to backspace
     }
     if (echo)
       serial.write(c);
@@ -152,19 +217,19 @@ at_error_t AtServer::readSerial() {
   return 0;
 }
 
-void AtServer::getTerminator(char* buffer, unsigned short buffer_size) {
+void AtServerBase::getTerminator(char* buffer, unsigned short buffer_size) {
   strncpy(buffer, terminator, buffer_size);
 }
 
-void AtServer::getOk(char* buffer, unsigned short buffer_size) {
+void AtServerBase::getOk(char* buffer, unsigned short buffer_size) {
   strncpy(buffer, verbose ? vres_ok : res_ok, buffer_size);
 }
 
-void AtServer::getError(char* buffer, unsigned short buffer_size) {
+void AtServerBase::getError(char* buffer, unsigned short buffer_size) {
   strncpy(buffer, verbose ? vres_err : res_err, buffer_size);
 }
 
-void AtServer::send(const char* str, bool ok, bool error) {
+void AtServerBase::send(const char* str, bool ok, bool error) {
   if (strlen(str) > 0)
     serial.write(str);
   if (ok) {
@@ -176,11 +241,11 @@ void AtServer::send(const char* str, bool ok, bool error) {
   }
 }
 
-void AtServer::send(String& str, bool ok, bool error) {
+void AtServerBase::send(String& str, bool ok, bool error) {
   send(str.c_str(), ok, error);
 }
 
-void AtServer::sendOk() {
+void AtServerBase::sendOk() {
   int buffer_size = 16;
   char to_write[buffer_size];
   strncpy(to_write, verbose ? vres_ok : res_ok, buffer_size);
@@ -191,7 +256,7 @@ void AtServer::sendOk() {
   serial.write(to_write);
 }
 
-void AtServer::sendError() {
+void AtServerBase::sendError() {
   int buffer_size = 24;
   char to_write[buffer_size];
   strncpy(to_write, verbose ? vres_err : res_err, buffer_size);
@@ -205,7 +270,7 @@ void AtServer::sendError() {
   serial.write(to_write);
 }
 
-bool AtServer::readSerialChar(bool ignore_unprintable) {
+bool AtServerBase::readSerialChar(bool ignore_unprintable) {
   bool success = false;
   if (serial.available() > 0) {
     if (!isRxBufferFull()) {
@@ -216,7 +281,8 @@ bool AtServer::readSerialChar(bool ignore_unprintable) {
         }
       } else {
         char* buf = commandPtr();
-        buf[strlen(buf)] = c;
+        buf[rx_len++] = c;
+        buf[rx_len] = '\0';
         success = true;
       }
     }
@@ -224,32 +290,23 @@ bool AtServer::readSerialChar(bool ignore_unprintable) {
   return success;
 }
 
-bool AtServer::isRxBufferFull() {
-  char* cmd = commandPtr();
-  return strlen(cmd) >= AT_SERVER_RX_BUFFERSIZE - 1;
+bool AtServerBase::isRxBufferFull() {
+  return rx_len >= rx_buffer_size - 1;
 }
 
-void AtServer::clearRxBuffer() {
-  #if defined(__AVR__) || defined(ESP8266)
-  memset(rx_buffer_P, 0, AT_SERVER_RX_BUFFERSIZE);
-  #else
-  memset(rx_buffer, 0, AT_SERVER_RX_BUFFERSIZE);
-  #endif
+void AtServerBase::clearRxBuffer() {
+  rx_buffer[0] = '\0';   // contents are only valid up to rx_len
+  rx_len = 0;
 }
 
-char* AtServer::commandPtr() {
-  #if defined(__AVR__)
-  return &rx_buffer_P[0];   // may need to extract to SRAM first?
-  #else  
-  return &rx_buffer[0];
-  #endif
+char* AtServerBase::commandPtr() {
+  return rx_buffer;
 }
 
-char AtServer::lastCharRead(size_t n) {
-  if (n <= 0)
+char AtServerBase::lastCharRead(size_t n) {
+  if (n <= 0 || rx_len < n)
     return -1;
-  char* cmd = commandPtr();
-  return cmd[strlen(cmd) - n];
+  return commandPtr()[rx_len - n];
 }
 
 }   // namespace at
\ No newline at end of file
@@ -98,18 +98,37 @@ bool append(String& target, const String& substr) {
   return true;
 }
 
+/**
+ * @brief Find the first instance of a substring within a length-bounded
+ * string, as `memmem` (not available on all Arduino toolchains).
+ * Uses `memchr` to skip to candidates for the first substring character.
+ * 
+ * @return Pointer to the first instance or nullptr if not found
+ */
+static const char* findSubstr(const char* str, size_t s_len,
+                              const char* substr, size_t ss_len) {
+  if (ss_len == 0 || ss_len > s_len)
+    return nullptr;
+  const char* p = str;
+  const char* last = str + s_len - ss_len;
+  while (p <= last) {
+    p = (const char*)memchr(p, substr[0], last - p + 1);
+    if (p == nullptr)
+      return nullptr;
+    if (memcmp(p + 1, substr + 1, ss_len - 1) == 0)
+      return p;
+    p++;
+  }
+  return nullptr;
+}
+
 bool includes(const char *str, const char *substr) {
   // AR_LOGV("Assessing %s for %s", debugString(str), debugString(substr).c_str());
   return strstr(str, substr) != nullptr;
 }
 
 bool includes(const char *str, const char c) {
-  size_t str_len = strlen(str);
-  for (size_t i = 0; i < str_len; i++) {
-    if (str[i] == c)
-      return true;
-  }
-  return false;
+  return c != '\0' && strchr(str, c) != nullptr;
 }
 
 bool includes(const String &str, const String &substr) {
@@ -126,72 +145,47 @@ bool includes(const String &str, const char c) {
 }
 
 int indexOf(const char *str, const char *substr) {
-  size_t s_len = strlen(str);
-  size_t ss_len = strlen(substr);
-  size_t char_matches = 0;
-  int index = -1;
-  if (ss_len > 0) {
-    for (size_t i = 0, j = 0; i < s_len; i++) {
-      if (str[i] == substr[j]) {
-        if (j == 0)
-          index = i;
-        char_matches++;
-        j++;
-        if (char_matches == ss_len) {
-          break;
-        }
-      } else if (char_matches > 0) {
-        char_matches = 0;
-        i--;
-        j = 0;
-      }
-    }
-  }
-  if (char_matches != ss_len)
-    index = -1;
-  return index;
+  const char* found = findSubstr(str, strlen(str), substr, strlen(substr));
+  return found != nullptr ? (int)(found - str) : -1;
 }
 
 int indexOf(const char *str, const char c) {
-  char subcstr[2];
-  subcstr[0] = c;
-  subcstr[1] = '\0';
-  return indexOf(str, subcstr);
+  const char* found = (c != '\0') ? strchr(str, c) : nullptr;
+  return found != nullptr ? (int)(found - str) : -1;
 }
 
-int instancesOf(const char *str, const char *substr) {
-  // AR_LOGV("Searching %s for %s", debugString(str).c_str(), debugString(substr).c_str());
-  int instances = 0;
-  size_t s_len = strlen(str);
-  size_t ss_len = strlen(substr);
-  size_t char_matches = 0;
-  if (ss_len > 0) {
-    for (size_t i = 0, j = 0; i < s_len; i++) {
-      // AR_LOGV("Assessing %s vs %s", debugString(str[i]).c_str(), debugString(substr[j]).c_str());
-      if (str[i] == substr[j]) {
-        // AR_LOGV("Found match for %s", debugString(substr[j]).c_str());
-        char_matches++;
-        j++;
-        if (char_matches == ss_len) {
-          instances += 1;
-          char_matches = 0;
-          j = 0;
-        }
-      } else if (char_matches > 0) {
-        // AR_LOGV("Mismatch for %s vs %s", debugString(substr[j]).c_str(), debugString(str[i]).c_str());
-        char_matches = 0;
-        i--;
-        j = 0;
-      }
-    }
+/**
+ * @brief Count non-overlapping instances of a substring, up to a limit
+ * 
+ * @param max_count The maximum to count (0 = unlimited)
+ */
+static size_t countSubstr(const char* str, size_t s_len,
+                          const char* substr, size_t ss_len,
+                          size_t max_count = 0) {
+  size_t instances = 0;
+  const char* end = str + s_len;
+  const char* p = findSubstr(str, s_len, substr, ss_len);
+  while (p != nullptr) {
+    instances++;
+    if (max_count > 0 && instances >= max_count)
+      break;
+    p += ss_len;
+    p = findSubstr(p, end - p, substr, ss_len);
   }
   return instances;
 }
 
+int instancesOf(const char *str, const char *substr) {
+  return (int)countSubstr(str, strlen(str), substr, strlen(substr));
+}
+
 int instancesOf(const char* str, const char c) {
-  char substr[2] = "";
-  substr[0] = c;
-  return instancesOf(str, (const char*)substr);
+  int instances = 0;
+  if (c == '\0')
+    return instances;
+  for (const char* p = strchr(str, c); p != nullptr; p = strchr(p + 1, c))
+    instances++;
+  return instances;
 }
 
 int instancesOf(const String &str, const String &substr) {
@@ -207,20 +201,12 @@ int instancesOf(const String &str, const String &substr) {
 bool startsWith(const char *str, const char *substr, bool end) {
   size_t s_len = strlen(str);
   size_t ss_len = strlen(substr);
-  size_t char_matches = 0;
-  int offset = end ? s_len - ss_len : 0;
-  if (ss_len > 0) {
-    if (s_len >= ss_len) {
-      for (size_t i = offset, j = 0; i < s_len; i++, j++) {
-        if (str[i] == substr[j]) {
-          char_matches++;
-          if (char_matches == ss_len)
-            break;
-        }
-      }
-    }
-  }
-  return char_matches == ss_len;
+  if (ss_len == 0)
+    return true;
+  if (s_len < ss_len)
+    return false;
+  size_t offset = end ? s_len - ss_len : 0;
+  return memcmp(str + offset, substr, ss_len) == 0;
 }
 
 bool startsWith(const char* str, const char c, bool end) {
@@ -297,55 +283,41 @@ bool remove(String &str, size_t index, size_t count) {
 
 bool replace(char *str, const char *old_substr, const char *new_substr,
              size_t buffer_size, size_t max_count) {
-  if (strcmp(old_substr, new_substr) == 0)
+  size_t s_len = strlen(str);
+  size_t old_len = strlen(old_substr);
+  size_t new_len = strlen(new_substr);
+  if (old_len == 0 || strcmp(old_substr, new_substr) == 0)
     return true;
-  int replacements = instancesOf((const char*)str, old_substr);
-  AR_LOGV("Found %d instances of %s to replace with %s", replacements, 
+  size_t replacements = countSubstr(str, s_len, old_substr, old_len, max_count);
+  AR_LOGV("Found %d instances of %s to replace with %s", (int)replacements,
       debugString(old_substr).c_str(), debugString(new_substr).c_str());
-  if (replacements > 0) {
-    size_t new_len = strlen(str) + (replacements *
-                     (strlen(new_substr) - strlen(old_substr)));
-    if (new_len >= buffer_size - 1) {
-      AR_LOGE("Buffer too small for replacement string");
-      return false;
-    }
-    int replacement_count = 0;
-    char *p_old = str;
-    std::vector<char> tmp = {};
-    size_t offset = strlen(new_substr);
-    while (includes((const char*)p_old, old_substr)) {
-      replacement_count++;
-      size_t idx = indexOf(p_old, old_substr);
-      AR_LOGV("Found %s in %s at index %d", debugString(old_substr).c_str(), 
-          debugString(p_old).c_str(), idx);
-      for (size_t i = 0; i < idx; i++) {
-        // AR_LOGV("Adding %s to vector", debugString(*p_old).c_str());
-        tmp.push_back(*p_old++);
-      }
-      for (size_t i = 0; i < offset; i++) {
-        // AR_LOGV("Adding %s to vector", debugString(new_substr[i]).c_str());
-        tmp.push_back(new_substr[i]);
-      }
-      p_old += strlen(old_substr);
-      if (max_count > 0 && replacement_count >= max_count)
-        break;
-    }
-    if (tmp.size() < new_len) {
-      size_t remaining_chars = strlen(p_old);
-      for (size_t i = 0; i < remaining_chars; i++) {
-        // AR_LOGV("Adding %s to vector", debugString(*p_old).c_str());
-        tmp.push_back(*p_old++);
-      }
-    }
-    tmp.push_back(0);   // terminate cstring
-    strncpy(str, tmp.data(), buffer_size);
-    if (strlen(tmp.data()) >= buffer_size) {
-      AR_LOGW("Resulting string exceeds buffer size - truncating");
-      str[buffer_size - 1] = 0;
-    }
-    AR_LOGV("Replaced %d - result: %s",
-        replacement_count, debugString(str).c_str());
+  if (replacements == 0)
+    return true;
+  size_t result_len = s_len - replacements * old_len + replacements * new_len;
+  if (result_len >= buffer_size - 1) {
+    AR_LOGE("Buffer too small for replacement string");
+    return false;
   }
+  // When growing, first move the original to the end of the buffer so the
+  // write cursor (from the start) can never overtake the read cursor.
+  size_t shift = result_len > s_len ? result_len - s_len : 0;
+  if (shift > 0)
+    memmove(str + shift, str, s_len + 1);
+  const char* r = str + shift;
+  const char* r_end = r + s_len;
+  char* w = str;
+  for (size_t n = 0; n < replacements; n++) {
+    const char* found = findSubstr(r, r_end - r, old_substr, old_len);
+    size_t keep = found - r;
+    memmove(w, r, keep);
+    w += keep;
+    memcpy(w, new_substr, new_len);
+    w += new_len;
+    r = found + old_len;
+  }
+  memmove(w, r, r_end - r + 1);   // remainder including terminator
+  AR_LOGV("Replaced %d - result: %s",
+      (int)replacements, debugString(str).c_str());
   return true;
 }
 
@@ -390,16 +362,56 @@ void trim(String &str) {
 
 long getNextParameter(char* at_param, const char* response,
                       size_t buffer_size, const char sep) {
-  if (strlen(response) == 0)
+  size_t s_len = strlen(response);
+  if (s_len == 0)
     return -1;
-  int extra_param_count = instancesOf(response, sep);
-  size_t param_end = extra_param_count > 0 ? indexOf(response, sep) : 0;
-  if (indexOf(response, sep) == 0) {
-    at_param[0] = '\0';
+  const char* found = (const char*)memchr(response, sep, s_len);
+  size_t param_len = found != nullptr ? (size_t)(found - response) : s_len;
+  size_t copy_len = param_len < buffer_size ? param_len : buffer_size - 1;
+  memcpy(at_param, response, copy_len);
+  at_param[copy_len] = '\0';
+  return (param_len + (found != nullptr ? 1 : 0));
+}
+
+AtTokenizer::AtTokenizer(const char* str, const char sep)
+    : AtTokenizer(AtSpan{ str, str != nullptr ? strlen(str) : 0 }, sep) {}
+
+AtTokenizer::AtTokenizer(const AtSpan& span, const char sep)
+    : data(span.ptr), data_len(span.len), sep(sep) {
+  done = (data == nullptr || data_len == 0);
+}
+
+bool AtTokenizer::next(AtSpan& param, bool unquote) {
+  if (done)
+    return false;
+  const char* end = data + data_len;
+  const char* start = data + pos;
+  while (start < end && *start == ' ')
+    start++;
+  const char* scan = start;
+  const char* quote_end = nullptr;
+  if (start < end && *start == '"') {
+    quote_end = (const char*)memchr(start + 1, '"', end - start - 1);
+    if (quote_end != nullptr)
+      scan = quote_end + 1;   // separators within quotes are not delimiters
+  }
+  const char* found = (const char*)memchr(scan, sep, end - scan);
+  const char* stop = found != nullptr ? found : end;
+  if (found != nullptr) {
+    pos = (found - data) + 1;
   } else {
-    substring(at_param, response, 0, param_end);
+    pos = data_len;
+    done = true;
+  }
+  while (stop > start && *(stop - 1) == ' ')
+    stop--;
+  if (unquote && quote_end != nullptr && quote_end < stop) {
+    start++;
+    stop = quote_end;
   }
-  return (strlen(at_param) + (extra_param_count > 0 ? 1 : 0));
+  param.ptr = start;
+  param.len = stop - start;
+  return true;
 }
 
 void uintToChar(uint32_t n, char *result, size_t result_size) {
@@ -0,0 +1,47 @@
+#include "aturcqueue.h"
+
+namespace at {
+
+bool AtUrcQueue::push(const char* line, size_t len) {
+  if (slot_count == 0) {
+    dropped_count++;
+    return false;
+  }
+  bool room = count < slot_count;
+  if (!room) {
+    AR_LOGW("URC queue full - dropping oldest: %s", slot(head));
+    head = (head + 1) % slot_count;
+    count--;
+    dropped_count++;
+  }
+  if (len >= slot_size) {
+    AR_LOGW("URC truncated to %u characters (%u dropped)",
+            (unsigned)(slot_size - 1), (unsigned)(len - (slot_size - 1)));
+    len = slot_size - 1;
+  }
+  char* dest = slot((head + count) % slot_count);
+  memcpy(dest, line, len);
+  dest[len] = '\0';
+  count++;
+  return room;
+}
+
+bool AtUrcQueue::pop(char* line, size_t buffer_size) {
+  if (count == 0)
+    return false;
+  if (buffer_size > 0) {
+    strncpy(line, slot(head), buffer_size - 1);
+    line[buffer_size - 1] = '\0';
+  }
+  head = (head + 1) % slot_count;
+  count--;
+  return true;
+}
+
+void AtUrcQueue::clear() {
+  head = 0;
+  count = 0;
+  dropped_count = 0;
+}
+
+}   // namespace at
@@ -0,0 +1,20 @@
+#include <unity.h>
+#include "../unittests/test_desktop/bench_atclient.cpp"
+
+int main(int argc, char** argv) {
+  at_test::stubArduino();
+  UNITY_BEGIN();
+
+  /* atclient */
+  RUN_TEST(bench_readAtResponse_4k);
+  RUN_TEST(bench_cleanResponse_4k);
+  RUN_TEST(bench_roundTrip);
+  RUN_TEST(bench_lineSink_256k);
+  RUN_TEST(bench_dispatchUrc_30);
+  RUN_TEST(bench_worker_contention);
+  RUN_TEST(bench_slowModem_cpu);
+  RUN_TEST(bench_footprint);
+
+  UNITY_END();
+  return 0;
+}
@@ -1,8 +1,16 @@
 #include <unity.h>
 #include "../unittests/test_desktop/test_atstringutils.cpp"
 #include "../unittests/test_desktop/test_crcxmodem.cpp"
+#include "../unittests/test_desktop/test_atmatcher.cpp"
+#include "../unittests/test_desktop/test_atclient.cpp"
+#include "../unittests/test_desktop/test_atcommandqueue.cpp"
+#include "../unittests/test_desktop/test_atdecode.cpp"
+#include "../unittests/test_desktop/test_atringbuffer.cpp"
+#include "../unittests/test_desktop/test_atclientworker.cpp"
+#include "../unittests/test_desktop/test_atserver.cpp"
 
 int main(int argc, char** argv) {
+  at_test::stubArduino();
   UNITY_BEGIN();
 
   /* atstringutils */
@@ -14,6 +22,8 @@ int main(int argc, char** argv) {
   RUN_TEST(test_startsWith_cstr);
   RUN_TEST(test_endsWith_cstr);
   RUN_TEST(test_replace_cstr);
+  RUN_TEST(test_replace_cstr_grow);
+  RUN_TEST(test_instancesOf_cstr);
   RUN_TEST(test_remove_cstr);
   RUN_TEST(test_substring_cstr);
   RUN_TEST(test_substring_cstr_to_end);
@@ -25,10 +35,65 @@ int main(int argc, char** argv) {
   RUN_TEST(test_base64Decode);
   RUN_TEST(test_indexOf_cstr);
   RUN_TEST(test_getNextParameter);
+  RUN_TEST(test_tokenizer);
 
   /* crcxmodem */
   RUN_TEST(test_applyCrc_cstr);
   RUN_TEST(test_validateCrc_cstr);
+
+  /* atmatcher */
+  RUN_TEST(test_matcher_overlapping);
+  RUN_TEST(test_matcher_echo);
+  RUN_TEST(test_matcher_echo_overlap);
+  RUN_TEST(test_matcher_capacity);
+
+  /* atclient */
+  RUN_TEST(test_client_ok);
+  RUN_TEST(test_client_response_view);
+  RUN_TEST(test_client_clean_multiline);
+  RUN_TEST(test_client_error);
+  RUN_TEST(test_client_cme_error);
+  RUN_TEST(test_client_short_ok);
+  RUN_TEST(test_client_short_info);
+  RUN_TEST(test_client_short_idle);
+  RUN_TEST(test_client_timeout);
+  RUN_TEST(test_client_urc);
+  RUN_TEST(test_client_urc_full_buffer);
+  RUN_TEST(test_client_urc_no_terminator);
+  RUN_TEST(test_client_urc_dispatch);
+  RUN_TEST(test_client_urc_during_command);
+  RUN_TEST(test_client_echo_after_urc);
+  RUN_TEST(test_client_result_codes);
+  RUN_TEST(test_client_poll);
+  RUN_TEST(test_client_data_mode);
+  RUN_TEST(test_client_line_sink);
+  RUN_TEST(test_client_sized);
+  RUN_TEST(test_client_long_command);
+  RUN_TEST(test_client_echo_mismatch);
+
+  /* atcommandqueue */
+  RUN_TEST(test_queue_batch);
+  RUN_TEST(test_queue_stop_on_error);
+
+  /* atdecode */
+  RUN_TEST(test_decode_response);
+  RUN_TEST(test_decode_lines);
+
+  /* atringbuffer */
+  RUN_TEST(test_ring_wrap_overflow);
+  RUN_TEST(test_ring_spsc_stress);
+  RUN_TEST(test_ring_client);
+
+  /* atclientworker */
+  RUN_TEST(test_worker_contention);
+  RUN_TEST(test_worker_callback_urc);
+  RUN_TEST(test_worker_reentrant);
+
+  /* atserver */
+  RUN_TEST(test_server_dispatch);
+  RUN_TEST(test_server_builtin);
+  RUN_TEST(test_server_command_table);
+  RUN_TEST(test_server_unsorted_table);
   
   UNITY_END();
   return 0;
@@ -0,0 +1,252 @@
+#include <atclient.h>
+#include <atclientworker.h>
+#include <atserver.h>
+#include <unity.h>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <thread>
+#include <vector>
+#include "memorystream.h"
+
+static const size_t bench_response_size = 4000;
+static const int bench_iterations = 200;
+
+/**
+ * @brief Build a verbose multi-line response close to the Rx buffer size
+ */
+static std::string benchResponse(size_t target_size) {
+  std::string response = "\r\n";
+  const char* line = "+DATA: 0123456789ABCDEF0123456789ABCDEF0123456789ABCDEF\r\n";
+  while (response.size() + strlen(line) + 6 < target_size)
+    response += line;
+  response += "\r\nOK\r\n";
+  return response;
+}
+
+static double benchSeconds(std::chrono::steady_clock::time_point start) {
+  using namespace std::chrono;
+  return duration_cast<duration<double>>(steady_clock::now() - start).count();
+}
+
+static void benchReport(const char* name, double bytes, double seconds) {
+  char msg[128];
+  snprintf(msg, sizeof(msg), "%s: %.0f bytes/s (%.1f us/iteration)",
+           name, bytes / seconds, seconds * 1e6 / bench_iterations);
+  TEST_MESSAGE(msg);
+}
+
+void bench_readAtResponse_4k() {
+  at_test::MemoryStream stream;
+  at::AtClient modem(stream);
+  std::string response = benchResponse(bench_response_size);
+  stream.setReply(response.c_str());
+  size_t total = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < bench_iterations; i++) {
+    TEST_ASSERT_EQUAL(AT_OK, modem.sendAtCommand("AT+DUMP"));
+    total += response.size();
+  }
+  double elapsed = benchSeconds(start);
+  TEST_ASSERT_TRUE(modem.responseReady());
+  benchReport("readAtResponse 4KB", total, elapsed);
+}
+
+void bench_cleanResponse_4k() {
+  at_test::MemoryStream stream;
+  at::AtClient modem(stream);
+  std::string response = benchResponse(bench_response_size);
+  stream.setReply(response.c_str());
+  static char clean[AT_CLIENT_RX_BUFFERSIZE];
+  size_t total = 0;
+  double elapsed = 0;
+  for (int i = 0; i < bench_iterations; i++) {
+    TEST_ASSERT_EQUAL(AT_OK, modem.sendAtCommand("AT+DUMP"));
+    auto start = std::chrono::steady_clock::now();
+    modem.getResponse(clean, "+DATA:", sizeof(clean));
+    elapsed += benchSeconds(start);
+    total += response.size();
+  }
+  TEST_ASSERT_EQUAL_STRING_LEN("0123456789ABCDEF", clean, 16);
+  benchReport("cleanResponse 4KB", total, elapsed);
+}
+
+static const char* bench_urc_prefixes[] = {
+  "+CREG:", "+CGREG:", "+CEREG:", "+CMTI:", "+CMT:", "+CDS:", "+CBM:",
+  "+CUSD:", "+CLIP:", "+CRING:", "+CCWA:", "+CSSU:", "+CTZV:", "+CIEV:",
+  "+CGEV:", "+CPIN:", "+QIURC:", "+QIND:", "+QPING:", "+QMTSTAT:",
+  "+QMTRECV:", "+UUSORD:", "+UUSOCL:", "+UUPSDA:", "%NOTIFYEV:", "%CESQ:",
+  "%IGNSSEVU:", "#SKTCLOSED:", "RING", "NO CARRIER",
+};
+static size_t bench_urc_count = 0;
+
+void bench_dispatchUrc_30() {
+  at_test::MemoryStream stream;
+  at::AtClientSized<AT_CLIENT_RX_BUFFERSIZE, AT_CLIENT_TX_BUFFERSIZE, 32> modem(stream);
+  for (const char* prefix : bench_urc_prefixes) {
+    TEST_ASSERT_TRUE(modem.addUrcHandler(prefix, [](const char*, const char*) {
+      bench_urc_count++;
+    }));
+  }
+  std::string urcs;
+  for (int i = 0; i < 30; i++) {
+    urcs += "\r\n";
+    urcs += bench_urc_prefixes[29 - i];
+    urcs += " 1,\"0123456789\",2\r\n";
+  }
+  bench_urc_count = 0;
+  size_t total = 0;
+  double elapsed = 0;
+  for (int i = 0; i < bench_iterations; i++) {
+    stream.load(urcs.c_str());
+    auto start = std::chrono::steady_clock::now();
+    while (modem.dispatchUrc()) {}
+    elapsed += benchSeconds(start);
+    total += urcs.size();
+  }
+  TEST_ASSERT_EQUAL(30 * bench_iterations, bench_urc_count);
+  benchReport("dispatchUrc 30 handlers", total, elapsed);
+}
+
+void bench_worker_contention() {
+  at_test::MemoryStream stream;
+  stream.setReply("\r\n+CSQ: 10,99\r\n\r\nOK\r\n");
+  at::AtClient modem(stream);
+  at::AtClientWorker worker(modem);
+  worker.start();
+  const int threads = 4;
+  const int per_thread = 1000;
+  std::atomic<int> errors{0};
+  std::vector<std::thread> producers;
+  auto start = std::chrono::steady_clock::now();
+  for (int t = 0; t < threads; t++) {
+    producers.emplace_back([&]() {
+      for (int i = 0; i < per_thread; i++) {
+        if (worker.sendAtCommand("AT+CSQ").error != AT_OK)
+          errors++;
+      }
+    });
+  }
+  for (auto& producer : producers)
+    producer.join();
+  double elapsed = benchSeconds(start);
+  worker.stop();
+  TEST_ASSERT_EQUAL(0, errors.load());
+  char msg[128];
+  snprintf(msg, sizeof(msg), "worker %d threads: %.0f commands/s",
+           threads, threads * per_thread / elapsed);
+  TEST_MESSAGE(msg);
+}
+
+void bench_roundTrip() {
+  at_test::MemoryStream stream;
+  at::AtClient modem(stream);
+  stream.setReply("\r\nOK\r\n");
+  const int commands = 20000;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < commands; i++) {
+    if (i % 1000 == 0) {
+      stream.reset();   // bound the captured Tx
+      stream.setReply("\r\nOK\r\n");
+    }
+    TEST_ASSERT_EQUAL(AT_OK, modem.sendAtCommand("AT"));
+  }
+  double elapsed = benchSeconds(start);
+  char msg[128];
+  snprintf(msg, sizeof(msg), "round trip AT/OK: %.2f us per command",
+           elapsed * 1e6 / commands);
+  TEST_MESSAGE(msg);
+}
+
+static size_t bench_sink_bytes = 0;
+
+void bench_lineSink_256k() {
+  at_test::MemoryStream stream;
+  at::AtClient modem(stream);
+  std::string response = benchResponse(256 * 1024);
+  stream.setReply(response.c_str());
+  bench_sink_bytes = 0;
+  auto start = std::chrono::steady_clock::now();
+  TEST_ASSERT_EQUAL(AT_OK, modem.sendAtCommandLines("AT+DUMP",
+      [](const char*, size_t len, bool, void*) {
+        bench_sink_bytes += len;
+      }));
+  double elapsed = benchSeconds(start);
+  TEST_ASSERT_GREATER_THAN(AT_CLIENT_RX_BUFFERSIZE, bench_sink_bytes);
+  char msg[128];
+  snprintf(msg, sizeof(msg), "lineSink 256KB: %.0f bytes/s",
+           response.size() / elapsed);
+  TEST_MESSAGE(msg);
+}
+
+/**
+ * @brief A MemoryStream whose reply only becomes readable a fixed latency
+ * after each command, like a modem that is slow to respond
+ */
+class SlowStream : public at_test::MemoryStream {
+  private:
+    std::chrono::milliseconds latency;
+    std::chrono::steady_clock::time_point ready_at;
+    bool ready() { return std::chrono::steady_clock::now() >= ready_at; }
+  public:
+    SlowStream(uint32_t latency_ms) : latency(latency_ms) {}
+    int available() override { return ready() ? MemoryStream::available() : 0; }
+    int read() override { return ready() ? MemoryStream::read() : -1; }
+    int peek() override { return ready() ? MemoryStream::peek() : -1; }
+    size_t write(uint8_t c) override {
+      if (c == '\r')
+        ready_at = std::chrono::steady_clock::now() + latency;
+      return MemoryStream::write(c);
+    }
+    size_t write(const uint8_t* buffer, size_t size) override {
+      for (size_t i = 0; i < size; i++)
+        write(buffer[i]);
+      return size;
+    }
+};
+
+static void benchSlowModem(const char* name, at::at_wait_fn_t wait) {
+  const int commands = 20;
+  SlowStream stream(20);
+  stream.setReply("\r\n+CSQ: 10,99\r\n\r\nOK\r\n");
+  at::AtClient modem(stream);
+  modem.setWaitFunction(wait);
+  std::clock_t cpu_start = std::clock();
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < commands; i++)
+    TEST_ASSERT_EQUAL(AT_OK, modem.sendAtCommand("AT+CSQ"));
+  double elapsed = benchSeconds(start);
+  double cpu = (double)(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+  char msg[128];
+  snprintf(msg, sizeof(msg), "%s: %.2f ms CPU per command (%.0f%% of %.1f ms)",
+           name, cpu * 1e3 / commands, 100 * cpu / elapsed,
+           elapsed * 1e3 / commands);
+  TEST_MESSAGE(msg);
+}
+
+void bench_slowModem_cpu() {
+  benchSlowModem("slow modem, spin wait", [](uint32_t, void*) {});
+  benchSlowModem("slow modem, waitYield", at::waitYield);
+  benchSlowModem("slow modem, waitDelay (default)", at::waitDelay);
+}
+
+template <class T>
+static void benchFootprint(const char* name) {
+  char msg[128];
+  snprintf(msg, sizeof(msg), "%s: %u bytes (%u fixed + %u sized)", name,
+           (unsigned)sizeof(T), (unsigned)sizeof(at::AtClientBase),
+           (unsigned)(sizeof(T) - sizeof(at::AtClientBase)));
+  TEST_MESSAGE(msg);
+}
+
+void bench_footprint() {
+  benchFootprint<at::AtClient>("AtClient (default)");
+  benchFootprint<at::AtClientSized<1024, 256>>("AtClientSized<1024, 256>");
+  benchFootprint<at::AtClientSized<256, 64>>("AtClientSized<256, 64>");
+  benchFootprint<at::AtClientSized<256, 64, 0, 0, 0>>(
+      "AtClientSized<256, 64, 0, 0, 0>");
+  char msg[64];
+  snprintf(msg, sizeof(msg), "AtServer (default): %u bytes",
+           (unsigned)sizeof(at::AtServer));
+  TEST_MESSAGE(msg);
+}
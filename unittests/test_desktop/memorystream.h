@@ -0,0 +1,123 @@
+/**
+ * @file memorystream.h
+ * @brief In-memory Stream for exercising the client/server on the native
+ * platform without a UART.
+ */
+#ifndef AT_TEST_MEMORYSTREAM_H
+#define AT_TEST_MEMORYSTREAM_H
+
+#include <Arduino.h>
+#include <chrono>
+#include <functional>
+#include <string>
+#include <thread>
+#if __has_include(<ArduinoFake.h>)
+#include <ArduinoFake.h>
+#endif
+
+namespace at_test {
+
+/**
+ * @brief A Stream that serves preloaded bytes and captures written bytes.
+ * Optionally replies to each written command line (ending `\r`) by echoing it
+ * followed by a canned reply, like an instantly responding modem.
+ */
+class MemoryStream : public Stream {
+  private:
+    std::string rx;
+    size_t rx_pos = 0;
+    std::string tx;
+    size_t tx_line = 0;
+    std::string reply;
+    bool reply_echo = true;
+    std::function<std::string(const std::string&)> responder;
+  public:
+    void load(const char* data, size_t len) {
+      if (rx_pos >= rx.size()) {
+        rx.clear();
+        rx_pos = 0;
+      }
+      rx.append(data, len);
+    }
+    void load(const char* data) { load(data, strlen(data)); }
+    void setReply(const char* response, bool echo = true) {
+      reply = response;
+      reply_echo = echo;
+    }
+    /**
+     * @brief Reply to each command line with the result of a function
+     * instead of a fixed reply (the command is still echoed if enabled)
+     */
+    void setResponder(std::function<std::string(const std::string&)> fn,
+                      bool echo = true) {
+      responder = fn;
+      reply_echo = echo;
+    }
+    void reset() {
+      rx.clear();
+      rx_pos = 0;
+      tx.clear();
+      tx_line = 0;
+      reply.clear();
+      responder = nullptr;
+    }
+    const std::string& written() { return tx; }
+    size_t remaining() { return rx.size() - rx_pos; }
+    int available() override { return (int)remaining(); }
+    int read() override {
+      return rx_pos < rx.size() ? (uint8_t)rx[rx_pos++] : -1;
+    }
+    int peek() override {
+      return rx_pos < rx.size() ? (uint8_t)rx[rx_pos] : -1;
+    }
+    size_t write(uint8_t c) override {
+      tx.push_back((char)c);
+      if (c == '\r' && (reply.length() > 0 || responder)) {
+        std::string line = tx.substr(tx_line);
+        if (reply_echo)
+          load(line.c_str(), line.size());
+        if (responder) {
+          std::string response = responder(line);
+          load(response.c_str(), response.size());
+        } else {
+          load(reply.c_str(), reply.length());
+        }
+        tx_line = tx.size();
+      }
+      return 1;
+    }
+    size_t write(const uint8_t* buffer, size_t size) override {
+      for (size_t i = 0; i < size; i++)
+        write(buffer[i]);
+      return size;
+    }
+    void flush() override {}
+};
+
+/**
+ * @brief Stub the Arduino time and wait functions when built against ArduinoFake.
+ */
+inline void stubArduino() {
+#if __has_include(<ArduinoFake.h>)
+  using namespace fakeit;
+  static const auto t0 = std::chrono::steady_clock::now();
+  When(Method(ArduinoFake(), millis)).AlwaysDo([]() -> unsigned long {
+    using namespace std::chrono;
+    return duration_cast<milliseconds>(steady_clock::now() - t0).count();
+  });
+  When(Method(ArduinoFake(), micros)).AlwaysDo([]() -> unsigned long {
+    using namespace std::chrono;
+    return duration_cast<microseconds>(steady_clock::now() - t0).count();
+  });
+  When(Method(ArduinoFake(), delay)).AlwaysDo([](unsigned long ms) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+  });
+  When(Method(ArduinoFake(), yield)).AlwaysDo([]() {
+    std::this_thread::yield();
+  });
+#endif
+}
+
+}   // namespace at_test
+
+#endif   // AT_TEST_MEMORYSTREAM_H
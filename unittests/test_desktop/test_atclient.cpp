@@ -0,0 +1,413 @@
+#include <atclient.h>
+#include <unity.h>
+#include "memorystream.h"
+
+void test_client_ok() {
+  at_test::MemoryStream stream;
+  at::AtClient modem(stream);
+  stream.setReply("\r\n+GSN: 00000000SKYEE3D\r\n\r\nOK\r\n");
+  TEST_ASSERT_EQUAL(AT_OK, modem.sendAtCommand("AT+GSN"));
+  TEST_ASSERT_EQUAL_STRING("AT+GSN\r", stream.written().c_str());
+  TEST_ASSERT_TRUE(modem.responseReady());
+  char response[64];
+  modem.getResponse(response, "+GSN:", sizeof(response));
+  TEST_ASSERT_EQUAL_STRING("00000000SKYEE3D", response);
+}
+
+void test_client_response_view() {
+  at_test::MemoryStream stream;
+  at::AtClient modem(stream);
+  stream.setReply("\r\n+CGDCONT: 1,\"IP\",\"apn\"\r\n"
+                  "+CGDCONT: 2,\"IPV6\",\"ims\"\r\n\r\nOK\r\n");
+  TEST_ASSERT_EQUAL(AT_OK, modem.sendAtCommand("AT+CGDCONT?"));
+  at::AtResponseView view = modem.responseView("+CGDCONT:");
+  TEST_ASSERT_FALSE(view.empty());
+  at::AtSpan line;
+  TEST_ASSERT_TRUE(view.nextLine(line));
+  TEST_ASSERT_TRUE(line.equals("1,\"IP\",\"apn\""));
+  TEST_ASSERT_TRUE(view.nextLine(line));
+  TEST_ASSERT_TRUE(line.equals("2,\"IPV6\",\"ims\""));
+  TEST_ASSERT_FALSE(view.nextLine(line));
+  view.rewind();
+  TEST_ASSERT_TRUE(view.nextLine(line));
+  TEST_ASSERT_TRUE(line.startsWith("1,"));
+  // the view does not consume the response
+  TEST_ASSERT_TRUE(modem.responseReady());
+}
+
+void test_client_clean_multiline() {
+  at_test::MemoryStream stream;
+  at::AtClient modem(stream);
+  stream.setReply("\r\n+CGDCONT: 1,\"IP\"\r\n\r\n+CGDCONT: 2,\"IPV6\"\r\n"
+                  "\r\nOK\r\n");
+  TEST_ASSERT_EQUAL(AT_OK, modem.sendAtCommand("AT+CGDCONT?"));
+  char response[64];
+  modem.getResponse(response, "+CGDCONT:", sizeof(response));
+  TEST_ASSERT_EQUAL_STRING("1,\"IP\"\n2,\"IPV6\"", response);
+}
+
+void test_client_error() {
+  at_test::MemoryStream stream;
+  at::AtClient modem(stream);
+  stream.setReply("\r\nERROR\r\n");
+  TEST_ASSERT_EQUAL(AT_ERROR, modem.sendAtCommand("AT+BAD"));
+}
+
+void test_client_cme_error() {
+  at_test::MemoryStream stream;
+  at::AtClient modem(stream);
+  stream.setReply("\r\n+CME ERROR: 10\r\n");
+  TEST_ASSERT_EQUAL(10, modem.sendAtCommand("AT+CPIN?"));
+}
+
+void test_client_short_ok() {
+  at_test::MemoryStream stream;
+  at::AtClient modem(stream);
+  stream.setReply("0\r");
+  TEST_ASSERT_EQUAL(AT_OK, modem.sendAtCommand("AT"));
+}
+
+void test_client_timeout() {
+  at_test::MemoryStream stream;
+  at::AtClient modem(stream);
+  TEST_ASSERT_EQUAL(AT_ERR_TIMEOUT, modem.sendAtCommand("AT", 50));
+}
+
+void test_client_urc() {
+  at_test::MemoryStream stream;
+  at::AtClient modem(stream);
+  stream.load("\r\n+CREG: 1\r\n");
+  TEST_ASSERT_TRUE(modem.checkUrc());
+  char urc[32];
+  modem.getResponse(urc, nullptr, sizeof(urc));
+  TEST_ASSERT_EQUAL_STRING("+CREG: 1", urc);
+  TEST_ASSERT_FALSE(modem.checkUrc());
+}
+
+void test_client_urc_full_buffer() {
+  at_test::MemoryStream stream;
+  at::AtClientSized<64, 64> modem(stream);
+  stream.load(std::string(200, 'a').c_str());
+  auto start = std::chrono::steady_clock::now();
+  TEST_ASSERT_FALSE(modem.checkUrc(nullptr, 50));
+  TEST_ASSERT_LESS_THAN(1000, std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - start).count());
+  TEST_ASSERT_FALSE(modem.responseReady());
+}
+
+/**
+ * @brief A Stream sending a URC prefix then one byte per millisecond
+ * forever, never reaching a line terminator
+ */
+class EndlessStream : public at_test::MemoryStream {
+  private:
+    std::chrono::steady_clock::time_point next_at;
+    bool sent_prefix = false;
+    bool ready() { return std::chrono::steady_clock::now() >= next_at; }
+  public:
+    int available() override { return ready() ? 1 : 0; }
+    int peek() override { return ready() ? (sent_prefix ? 'a' : '+') : -1; }
+    int read() override {
+      if (!ready())
+        return -1;
+      next_at = std::chrono::steady_clock::now() + std::chrono::milliseconds(1);
+      if (sent_prefix)
+        return 'a';
+      sent_prefix = true;
+      return '+';
+    }
+};
+
+void test_client_urc_no_terminator() {
+  EndlessStream stream;
+  at::AtClient modem(stream);
+  auto start = std::chrono::steady_clock::now();
+  TEST_ASSERT_FALSE(modem.checkUrc(nullptr, 50));
+  TEST_ASSERT_LESS_THAN(1000, std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - start).count());
+}
+
+static int urc_creg = 0;
+static int urc_ring = 0;
+static char urc_params[32];
+
+void test_client_urc_dispatch() {
+  at_test::MemoryStream stream;
+  at::AtClient modem(stream);
+  urc_creg = 0;
+  urc_ring = 0;
+  TEST_ASSERT_TRUE(modem.addUrcHandler("+CREG:", [](const char*, const char* params) {
+    urc_creg++;
+    snprintf(urc_params, sizeof(urc_params), "%s", params);
+  }));
+  TEST_ASSERT_TRUE(modem.addUrcHandler("+C", [](const char*, const char*) {}));
+  TEST_ASSERT_TRUE(modem.addUrcHandler("RING", [](const char*, const char*) {
+    urc_ring++;
+  }));
+  stream.load("\r\n+CREG: 5,\"00C3\"\r\n\r\nRING\r\n\r\n%NOTIFYEV: 1\r\n");
+  TEST_ASSERT_TRUE(modem.dispatchUrc());
+  TEST_ASSERT_EQUAL(1, urc_creg);
+  TEST_ASSERT_EQUAL_STRING("5,\"00C3\"", urc_params);
+  TEST_ASSERT_FALSE(modem.responseReady());
+  TEST_ASSERT_TRUE(modem.dispatchUrc());
+  TEST_ASSERT_EQUAL(1, urc_ring);
+  // unhandled URCs remain for retrieval
+  TEST_ASSERT_TRUE(modem.dispatchUrc());
+  TEST_ASSERT_TRUE(modem.responseReady());
+  char urc[32];
+  modem.getResponse(urc, nullptr, sizeof(urc));
+  TEST_ASSERT_EQUAL_STRING("%NOTIFYEV: 1", urc);
+  TEST_ASSERT_FALSE(modem.dispatchUrc());
+}
+
+void test_client_urc_during_command() {
+  at_test::MemoryStream stream;
+  at::AtClient modem(stream);
+  urc_creg = 0;
+  urc_ring = 0;
+  modem.addUrcHandler("+CREG:", [](const char*, const char*) { urc_creg++; });
+  modem.addUrcHandler("RING", [](const char*, const char*) { urc_ring++; });
+  stream.load("\r\nRING\r\n");   // before the command is sent
+  stream.setReply("\r\n+CREG: 1\r\n\r\n+CGDCONT: 1,\"IP\"\r\n"
+                  "\r\nRING\r\n\r\nOK\r\n");
+  TEST_ASSERT_EQUAL(AT_OK, modem.sendAtCommand("AT+CGDCONT?"));
+  char response[64];
+  modem.getResponse(response, "+CGDCONT:", sizeof(response));
+  TEST_ASSERT_EQUAL_STRING("1,\"IP\"", response);
+  TEST_ASSERT_EQUAL(3, modem.urcsQueued());
+  // a solicited response sharing a URC prefix is not taken
+  stream.setReply("\r\n+CREG: 0,1\r\n\r\nOK\r\n");
+  TEST_ASSERT_EQUAL(AT_OK, modem.sendAtCommand("AT+CREG?"));
+  modem.getResponse(response, "+CREG:", sizeof(response));
+  TEST_ASSERT_EQUAL_STRING("0,1", response);
+  TEST_ASSERT_EQUAL(3, modem.urcsQueued());
+  while (modem.dispatchUrc()) {}
+  TEST_ASSERT_EQUAL(1, urc_creg);
+  TEST_ASSERT_EQUAL(2, urc_ring);
+  TEST_ASSERT_EQUAL(0, modem.urcsQueued());
+}
+
+void test_client_echo_after_urc() {
+  at_test::MemoryStream stream;
+  at::AtClient modem(stream);
+  stream.load("\r\n+CREG: 1\r\n");
+  stream.setReply("\r\n+CSQ: 10,99\r\n\r\nOK\r\n");
+  TEST_ASSERT_EQUAL(AT_OK, modem.sendAtCommand("AT+CSQ"));
+  char response[32];
+  modem.getResponse(response, "+CSQ:", sizeof(response));
+  TEST_ASSERT_EQUAL_STRING("10,99", response);
+}
+
+void test_client_short_info() {
+  at_test::MemoryStream stream;
+  at::AtClient modem(stream);
+  stream.setReply("+CSQ: 10,90\r\n0\r");
+  TEST_ASSERT_EQUAL(AT_OK, modem.sendAtCommand("AT+CSQ"));
+  stream.setReply("4\r");
+  TEST_ASSERT_EQUAL(AT_ERROR, modem.sendAtCommand("AT+CSQ=0"));
+}
+
+void test_client_short_idle() {
+  at_test::MemoryStream stream;
+  at::AtClient modem(stream);
+  modem.setBaudRate(115200);
+  TEST_ASSERT_EQUAL(AT_IDLE_MIN_US, at::AtClient::idleMicros(115200));
+  TEST_ASSERT_EQUAL(4010, at::AtClient::idleMicros(9600));
+  // a short code candidate followed by more data is not final
+  stream.setReply("+X: 1\r\n0\r\n+X: 2\r\n0\r");
+  auto start = std::chrono::steady_clock::now();
+  TEST_ASSERT_EQUAL(AT_OK, modem.sendAtCommand("AT+X"));
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  TEST_ASSERT_TRUE(elapsed < std::chrono::milliseconds(50));
+  char response[32];
+  modem.getResponse(response, nullptr, sizeof(response));
+  TEST_ASSERT_EQUAL_STRING("+X: 1\n0\n+X: 2", response);
+  stream.setReply("\r\nERROR\r\n");
+  start = std::chrono::steady_clock::now();
+  TEST_ASSERT_EQUAL(AT_ERROR, modem.sendAtCommand("AT+X=9"));
+  elapsed = std::chrono::steady_clock::now() - start;
+  TEST_ASSERT_TRUE(elapsed < std::chrono::milliseconds(50));
+}
+
+static const char binary_payload[] = { 'A', '\0', '\r', '\n', (char)0xFF,
+                                       'O', 'K', '\r', '\n' };
+
+static std::string binaryResponder(const std::string&) {
+  return "\r\n+QIRD: 9\r\n" + std::string(binary_payload, 9) + "\r\nOK\r\n";
+}
+
+static size_t sink_total = 0;
+
+void test_client_data_mode() {
+  at_test::MemoryStream stream;
+  stream.setResponder(binaryResponder);
+  at::AtClient modem(stream);
+  uint8_t data[16];
+  size_t data_len = 0;
+  TEST_ASSERT_EQUAL(AT_OK, modem.sendAtCommandData("AT+QIRD=0,16", "+QIRD:",
+                                                   data, sizeof(data), data_len));
+  TEST_ASSERT_EQUAL(9, data_len);
+  TEST_ASSERT_EQUAL_MEMORY(binary_payload, data, 9);
+  char response[32];
+  modem.getResponse(response, "+QIRD:", sizeof(response));
+  TEST_ASSERT_EQUAL_STRING("9", response);
+  // a short buffer keeps what fits and still completes the command
+  TEST_ASSERT_EQUAL(AT_OK, modem.sendAtCommandData("AT+QIRD=0,16", "+QIRD:",
+                                                   data, 4, data_len));
+  TEST_ASSERT_EQUAL(9, data_len);
+  TEST_ASSERT_EQUAL_MEMORY(binary_payload, data, 4);
+  sink_total = 0;
+  TEST_ASSERT_EQUAL(AT_OK, modem.sendAtCommandData("AT+QIRD=0,16", "+QIRD:",
+      [](const uint8_t*, size_t len, void*) { sink_total += len; },
+      nullptr, data_len));
+  TEST_ASSERT_EQUAL(9, sink_total);
+  stream.reset();
+  TEST_ASSERT_EQUAL(9, modem.writeData((const uint8_t*)binary_payload, 9));
+  TEST_ASSERT_EQUAL(9, stream.written().size());
+  TEST_ASSERT_EQUAL_MEMORY(binary_payload, stream.written().data(), 9);
+}
+
+// the built-in result code trie, plus padding for the empty tables
+AT_ASSERT_FOOTPRINT(sizeof(at::AtClientBase) + 128 + 32 +
+                    AT_MATCHER_BUILTIN_NODES * sizeof(at::AtMatcherBase::Node) +
+                    AT_MATCHER_BUILTIN_PATTERNS *
+                    sizeof(at::AtMatcherBase::Pattern) + sizeof(void*),
+                    at::AtClientSized<128, 32, 0, 0, 0>);
+
+void test_client_sized() {
+  at_test::MemoryStream stream;
+  at::AtClientSized<128, 32, 0, 0, 0> modem(stream);
+  TEST_ASSERT_LESS_THAN(sizeof(at::AtClient) - 7000, sizeof(modem));
+  TEST_ASSERT_FALSE(modem.addUrcHandler("+CREG:", [](const char*, const char*) {}));
+  TEST_ASSERT_FALSE(modem.addResultCode("\r\nNO CARRIER\r\n"));
+  stream.setReply("\r\n+CME ERROR: 10\r\n");
+  TEST_ASSERT_EQUAL(10, modem.sendAtCommand("AT+CPIN?"));
+  stream.setReply("\r\n+GSN: 00000000SKYEE3D\r\n\r\nOK\r\n");
+  TEST_ASSERT_EQUAL(AT_OK, modem.sendAtCommand("AT+GSN"));
+  char response[64];
+  modem.getResponse(response, "+GSN:", sizeof(response));
+  TEST_ASSERT_EQUAL_STRING("00000000SKYEE3D", response);
+  std::string big = "\r\n+DATA: " + std::string(200, 'x') + "\r\n\r\nOK\r\n";
+  stream.setReply(big.c_str());
+  TEST_ASSERT_TRUE(modem.sendAtCommand("AT+DATA") != AT_OK);
+}
+
+void test_client_long_command() {
+  at_test::MemoryStream stream;
+  at::AtClientSized<128, 16> modem(stream);
+  std::string cmd = "AT+QCFG=\"" + std::string(40, 'x') + "\"";
+  stream.setReply("\r\nOK\r\n");
+  TEST_ASSERT_EQUAL(AT_OK, modem.sendAtCommand(cmd.c_str()));
+  TEST_ASSERT_EQUAL_STRING((cmd + "\r").c_str(), stream.written().c_str());
+  // an async command must be copied to outlive the caller's string
+  TEST_ASSERT_FALSE(modem.submitAtCommand(cmd.c_str()));
+  TEST_ASSERT_EQUAL(AT_ERR_CMD_LENGTH, modem.lastErrorCode());
+}
+
+void test_client_echo_mismatch() {
+  at_test::MemoryStream stream;
+  at::AtClient modem(stream);
+  stream.setReply("#$AT+GSN\r\r\n+GSN: 123\r\n\r\nOK\r\n", false);
+  TEST_ASSERT_EQUAL(AT_OK, modem.sendAtCommand("AT+GSN"));
+  TEST_ASSERT_EQUAL(2, modem.echoSkipped());
+  TEST_ASSERT_FALSE(modem.echoMissed());
+  char response[32];
+  modem.getResponse(response, "+GSN:", sizeof(response));
+  TEST_ASSERT_EQUAL_STRING("123", response);
+  stream.setReply("\r\n+GSN: 123\r\n\r\nOK\r\n", false);
+  TEST_ASSERT_EQUAL(AT_OK, modem.sendAtCommand("AT+GSN"));
+  TEST_ASSERT_TRUE(modem.echoMissed());
+}
+
+struct SinkStats {
+  size_t lines = 0;
+  size_t bytes = 0;
+  size_t partial = 0;
+  bool ordered = true;
+};
+
+void test_client_line_sink() {
+  at_test::MemoryStream stream;
+  at::AtClient modem(stream);
+  std::string response;
+  char line[32];
+  for (int i = 0; i < 1000; i++) {
+    snprintf(line, sizeof(line), "+CMGL: %d,\"REC READ\"\r\n", i);
+    response += line;
+  }
+  response += std::string(AT_CLIENT_RX_BUFFERSIZE + 100, 'x') + "\r\n";
+  response += "\r\nOK\r\n";
+  stream.setReply(response.c_str());
+  SinkStats stats;
+  TEST_ASSERT_EQUAL(AT_OK, modem.sendAtCommandLines("AT+CMGL",
+      [](const char* line, size_t len, bool complete, void* context) {
+        SinkStats* stats = (SinkStats*)context;
+        if (!complete) {
+          stats->partial++;
+        } else if (stats->lines < 1000) {
+          char expected[32];
+          int n = snprintf(expected, sizeof(expected), "+CMGL: %d,\"REC READ\"",
+                           (int)stats->lines);
+          if ((size_t)n != len || strncmp(line, expected, len) != 0)
+            stats->ordered = false;
+        }
+        if (complete)
+          stats->lines++;
+        stats->bytes += len;
+      }, &stats));
+  TEST_ASSERT_EQUAL(1001, stats.lines);
+  TEST_ASSERT_TRUE(stats.ordered);
+  TEST_ASSERT_EQUAL(1, stats.partial);
+  TEST_ASSERT_EQUAL(response.size() - 2 * 1001 - 6, stats.bytes);
+}
+
+void test_client_result_codes() {
+  at_test::MemoryStream stream;
+  at::AtClient modem(stream);
+  TEST_ASSERT_TRUE(modem.addResultCode("\r\nNO CARRIER\r\n", AT_ERR_TIMEOUT));
+  TEST_ASSERT_TRUE(modem.addResultCode("\r\nSEND OK\r\n", AT_OK));
+  TEST_ASSERT_TRUE(modem.addResultCode("\r\n+CMS ERROR:", 500, AT_RESULT_LINE));
+  TEST_ASSERT_TRUE(modem.addResultCode("\r\n> ", AT_OK, AT_RESULT_PROMPT));
+  stream.setReply("\r\nNO CARRIER\r\n");
+  TEST_ASSERT_EQUAL(AT_ERR_TIMEOUT, modem.sendAtCommand("ATD123", 5000));
+  stream.setReply("\r\nSEND OK\r\n");
+  TEST_ASSERT_EQUAL(AT_OK, modem.sendAtCommand("AT+SEND", 5000));
+  stream.setReply("\r\n+CMS ERROR: 304\r\n");
+  TEST_ASSERT_EQUAL(500, modem.sendAtCommand("AT+CMGS", 5000));
+  char response[32];
+  modem.getResponse(response, "+CMS ERROR:", sizeof(response), true);
+  TEST_ASSERT_EQUAL_STRING("304", response);
+  stream.setReply("\r\n> ");
+  TEST_ASSERT_EQUAL(AT_OK, modem.sendAtCommand("AT+CIPSEND=4", 5000));
+}
+
+static at_error_t async_error = AT_PENDING;
+static char async_response[32];
+
+static void onAsyncComplete(at_error_t error, const char* response) {
+  async_error = error;
+  snprintf(async_response, sizeof(async_response), "%s", response);
+}
+
+void test_client_poll() {
+  at_test::MemoryStream stream;
+  at::AtClient modem(stream);
+  async_error = AT_PENDING;
+  TEST_ASSERT_TRUE(modem.submitAtCommand("AT+CSQ", 1000, onAsyncComplete));
+  TEST_ASSERT_TRUE(modem.commandPending());
+  TEST_ASSERT_FALSE(modem.submitAtCommand("AT"));
+  TEST_ASSERT_EQUAL(AT_PENDING, modem.poll());
+  stream.load("AT+CSQ\r\r\n+CSQ: 1");
+  TEST_ASSERT_EQUAL(AT_PENDING, modem.poll());
+  stream.load("0,99\r\n\r\nOK\r\n");
+  TEST_ASSERT_EQUAL(AT_OK, modem.poll());
+  TEST_ASSERT_FALSE(modem.commandPending());
+  TEST_ASSERT_EQUAL(AT_OK, async_error);
+  TEST_ASSERT_EQUAL_STRING("+CSQ: 10,99", async_response);
+  char response[32];
+  modem.getResponse(response, "+CSQ:", sizeof(response));
+  TEST_ASSERT_EQUAL_STRING("10,99", response);
+  TEST_ASSERT_EQUAL(AT_PENDING, modem.sendAtCommand("AT", 0));
+  stream.load("AT\r\r\nOK\r\n");
+  TEST_ASSERT_EQUAL(AT_OK, modem.poll());
+}
@@ -0,0 +1,91 @@
+#include <atclientworker.h>
+#include <unity.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "memorystream.h"
+
+/**
+ * @brief Reply to `AT+ID=<n>` with `+ID: <n>` so results can be routed back
+ */
+static std::string workerResponder(const std::string& command) {
+  std::string id = command.substr(6, command.size() - 7);
+  return "\r\n+ID: " + id + "\r\n\r\nOK\r\n";
+}
+
+void test_worker_contention() {
+  at_test::MemoryStream stream;
+  stream.setResponder(workerResponder);
+  at::AtClient modem(stream);
+  at::AtClientWorker worker(modem, 4);
+  worker.start();
+  const int threads = 4;
+  const int per_thread = 100;
+  std::atomic<int> mismatches{0};
+  std::vector<std::thread> producers;
+  for (int t = 0; t < threads; t++) {
+    producers.emplace_back([&, t]() {
+      for (int i = 0; i < per_thread; i++) {
+        String id = String(t * per_thread + i);
+        String command = "AT+ID=" + id;
+        at::AtResult result = worker.sendAtCommand(command.c_str(),
+                                                   AT_TIMEOUT_MS, "+ID:");
+        if (result.error != AT_OK || result.response != id)
+          mismatches++;
+      }
+    });
+  }
+  for (auto& producer : producers)
+    producer.join();
+  worker.stop();
+  TEST_ASSERT_EQUAL(0, mismatches.load());
+  TEST_ASSERT_EQUAL(0, worker.queued());
+}
+
+static std::atomic<int> worker_callbacks{0};
+
+void test_worker_callback_urc() {
+  at_test::MemoryStream stream;
+  stream.setReply("\r\nOK\r\n");
+  at::AtClient modem(stream);
+  static std::atomic<int> urcs{0};
+  urcs = 0;
+  worker_callbacks = 0;
+  modem.addUrcHandler("RING", [](const char*, const char*) { urcs++; });
+  at::AtClientWorker worker(modem);
+  TEST_ASSERT_FALSE(worker.submit("AT", [](const at::AtResult&, void*) {}));
+  stream.load("\r\nRING\r\n");   // before the worker owns the stream
+  worker.start();
+  TEST_ASSERT_TRUE(worker.submit("AT", [](const at::AtResult& result, void*) {
+    if (result.error == AT_OK)
+      worker_callbacks++;
+  }));
+  auto start = std::chrono::steady_clock::now();
+  while (urcs == 0 &&
+         std::chrono::steady_clock::now() - start < std::chrono::seconds(1))
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  worker.stop();   // completes queued commands
+  TEST_ASSERT_EQUAL(1, worker_callbacks.load());
+  TEST_ASSERT_EQUAL(1, urcs.load());
+  TEST_ASSERT_EQUAL(AT_ERR_BUSY, worker.sendAtCommand("AT").error);
+}
+
+static std::atomic<int> worker_nested_error{0};
+
+void test_worker_reentrant() {
+  at_test::MemoryStream stream;
+  stream.setReply("\r\nOK\r\n");
+  at::AtClient modem(stream);
+  at::AtClientWorker worker(modem);
+  worker.start();
+  // 0 is not the client's non-blocking mode, which would leave it pending
+  TEST_ASSERT_EQUAL(AT_OK, worker.sendAtCommand("AT", 0).error);
+  TEST_ASSERT_EQUAL(AT_OK, worker.sendAtCommand("AT").error);
+  worker_nested_error = AT_OK;
+  TEST_ASSERT_TRUE(worker.submit("AT", [](const at::AtResult&, void* context) {
+    auto worker = static_cast<at::AtClientWorker*>(context);
+    worker_nested_error = worker->sendAtCommand("AT").error;
+  }, &worker));
+  worker.stop();
+  TEST_ASSERT_EQUAL(AT_ERR_BUSY, worker_nested_error.load());
+}
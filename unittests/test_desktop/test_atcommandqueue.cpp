@@ -0,0 +1,51 @@
+#include <atcommandqueue.h>
+#include <unity.h>
+#include "memorystream.h"
+
+static size_t queue_handled = 0;
+
+static void onQueued(size_t index, at_error_t, const char*) {
+  TEST_ASSERT_EQUAL(queue_handled, index);
+  queue_handled++;
+}
+
+void test_queue_batch() {
+  at_test::MemoryStream stream;
+  at::AtClient modem(stream);
+  at::AtCommandQueue queue(modem);
+  stream.setReply("\r\nOK\r\n");
+  at::AtQueuedCommand batch[] = {
+    { "ATE1", 1000, onQueued, AT_PENDING },
+    { "AT+CMEE=1", 1000, onQueued, AT_PENDING },
+    { "AT+CFUN=1", 1000, onQueued, AT_PENDING },
+  };
+  queue_handled = 0;
+  TEST_ASSERT_TRUE(queue.submit(batch, 3));
+  TEST_ASSERT_EQUAL(AT_OK, queue.poll());   // replies are instant
+  TEST_ASSERT_FALSE(queue.busy());
+  TEST_ASSERT_EQUAL(3, queue.completed());
+  TEST_ASSERT_EQUAL(3, queue_handled);
+  TEST_ASSERT_EQUAL_STRING("ATE1\rAT+CMEE=1\rAT+CFUN=1\r",
+                           stream.written().c_str());
+}
+
+void test_queue_stop_on_error() {
+  at_test::MemoryStream stream;
+  at::AtClient modem(stream);
+  at::AtCommandQueue queue(modem);
+  at::AtQueuedCommand batch[] = {
+    { "AT+A", 1000, nullptr, AT_PENDING },
+    { "AT+B", 1000, nullptr, AT_PENDING },
+    { "AT+C", 1000, nullptr, AT_PENDING },
+  };
+  TEST_ASSERT_TRUE(queue.submit(batch, 3, true));
+  TEST_ASSERT_EQUAL(AT_PENDING, queue.poll());
+  stream.load("AT+A\r\r\nOK\r\n");
+  TEST_ASSERT_EQUAL(AT_PENDING, queue.poll());
+  stream.load("AT+B\r\r\nERROR\r\n");
+  TEST_ASSERT_EQUAL(AT_ERROR, queue.run());
+  TEST_ASSERT_EQUAL(AT_OK, batch[0].error);
+  TEST_ASSERT_EQUAL(AT_ERROR, batch[1].error);
+  TEST_ASSERT_EQUAL(AT_PENDING, batch[2].error);
+  TEST_ASSERT_EQUAL(2, queue.completed());
+}
@@ -0,0 +1,56 @@
+#include <atdecode.h>
+#include <unity.h>
+#include "memorystream.h"
+
+struct DecodeCsq {
+  int rssi;
+  uint8_t ber;
+};
+
+struct DecodeContext {
+  uint8_t cid;
+  char pdp_type[8];
+  at::AtSpan apn;
+  uint16_t flags;
+  bool active;
+};
+
+void test_decode_response() {
+  at_test::MemoryStream stream;
+  at::AtClient modem(stream);
+  stream.setReply("\r\n+CSQ: -71,99\r\n\r\nOK\r\n");
+  TEST_ASSERT_EQUAL(AT_OK, modem.sendAtCommand("AT+CSQ"));
+  DecodeCsq csq;
+  TEST_ASSERT_EQUAL(AT_OK, at::decodeResponse(modem.responseView("+CSQ:"),
+      csq, &DecodeCsq::rssi, &DecodeCsq::ber));
+  TEST_ASSERT_EQUAL(-71, csq.rssi);
+  TEST_ASSERT_EQUAL(99, csq.ber);
+  // out of range for uint8_t
+  TEST_ASSERT_EQUAL(AT_ERR_PARSE, at::decodeLine(at::AtSpan{ "1,300", 5 },
+      csq, &DecodeCsq::rssi, &DecodeCsq::ber));
+  // missing field
+  TEST_ASSERT_EQUAL(AT_ERR_PARSE, at::decodeLine(at::AtSpan{ "1", 1 },
+      csq, &DecodeCsq::rssi, &DecodeCsq::ber));
+}
+
+void test_decode_lines() {
+  at_test::MemoryStream stream;
+  at::AtClient modem(stream);
+  stream.setReply("\r\n+CGDCONT: 1,\"IP\",\"apn\",,1F,1\r\n"
+                  "+CGDCONT: 2,\"IPV6\",\"ims\",,0,0\r\n\r\nOK\r\n");
+  TEST_ASSERT_EQUAL(AT_OK, modem.sendAtCommand("AT+CGDCONT?"));
+  DecodeContext contexts[4];
+  size_t count;
+  TEST_ASSERT_EQUAL(AT_OK, at::decodeLines(modem.responseView("+CGDCONT:"),
+      contexts, 4, count, &DecodeContext::cid, &DecodeContext::pdp_type,
+      &DecodeContext::apn, at::AtSkipField(),
+      at::hexField(&DecodeContext::flags), &DecodeContext::active));
+  TEST_ASSERT_EQUAL(2, count);
+  TEST_ASSERT_EQUAL(1, contexts[0].cid);
+  TEST_ASSERT_EQUAL_STRING("IP", contexts[0].pdp_type);
+  TEST_ASSERT_TRUE(contexts[0].apn.equals("apn"));
+  TEST_ASSERT_EQUAL(0x1F, contexts[0].flags);
+  TEST_ASSERT_TRUE(contexts[0].active);
+  TEST_ASSERT_EQUAL_STRING("IPV6", contexts[1].pdp_type);
+  TEST_ASSERT_FALSE(contexts[1].active);
+}
@@ -0,0 +1,53 @@
+#include <atmatcher.h>
+#include <unity.h>
+
+static uint8_t feedAll(at::AtMatcher<64, 8>& matcher, const char* str) {
+  uint8_t tag = 0;
+  while (*str)
+    tag = matcher.feed(*str++);
+  return tag;
+}
+
+void test_matcher_overlapping() {
+  at::AtMatcher<64, 8> matcher;
+  matcher.add("\r\nOK\r\n", 1);
+  matcher.add("\r\nERROR\r\n", 2);
+  matcher.add("K\r", 3);
+  TEST_ASSERT_EQUAL(1, feedAll(matcher, "\r\n\r\n\r\nOK\r\n"));
+  TEST_ASSERT_EQUAL(6, matcher.matchLength());
+  matcher.reset();
+  TEST_ASSERT_EQUAL(2, feedAll(matcher, "\r\nOK,\r\nERROR\r\n"));
+  matcher.reset();
+  TEST_ASSERT_EQUAL(3, feedAll(matcher, "+OK\r"));
+  TEST_ASSERT_EQUAL(0, feedAll(matcher, "\nOK"));
+}
+
+void test_matcher_echo() {
+  at::AtMatcher<64, 8> matcher;
+  matcher.add("0\r", 1);
+  matcher.setEcho("AT+X=0\r", 9);
+  TEST_ASSERT_EQUAL(9, feedAll(matcher, "garbageAT+AT+X=0\r"));
+  TEST_ASSERT_EQUAL(7, matcher.matchLength());
+  TEST_ASSERT_EQUAL(1, feedAll(matcher, "0\r"));
+}
+
+void test_matcher_echo_overlap() {
+  at::AtMatcher<64, 8> matcher;
+  matcher.setEcho("AAB", 9);
+  TEST_ASSERT_EQUAL(9, feedAll(matcher, "AAAB"));
+  matcher.setEcho("ATAT+C", 9, '\r');
+  TEST_ASSERT_EQUAL(9, feedAll(matcher, "ATATATAT+C\r"));
+  matcher.setEcho("AT+CMGS", 9, '\r');
+  TEST_ASSERT_EQUAL(9, feedAll(matcher, "AAT+AT+CMGS\r"));
+}
+
+void test_matcher_capacity() {
+  at::AtMatcher<8, 2> matcher;
+  TEST_ASSERT_TRUE(matcher.add("ABCD", 1));
+  TEST_ASSERT_TRUE(matcher.add("ABXY", 2));
+  TEST_ASSERT_FALSE(matcher.add("Z", 3));
+  TEST_ASSERT_TRUE(matcher.compile());
+  matcher.clear();
+  matcher.add("ABCDEFGHIJ", 1);
+  TEST_ASSERT_FALSE(matcher.compile());
+}
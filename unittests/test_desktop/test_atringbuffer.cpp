@@ -0,0 +1,91 @@
+#include <atringbuffer.h>
+#include <atclient.h>
+#include <unity.h>
+#include <atomic>
+#include <thread>
+#include "memorystream.h"
+
+void test_ring_wrap_overflow() {
+  at::AtRingBuffer<8> ring;
+  uint8_t out[8];
+  TEST_ASSERT_EQUAL(6, ring.push((const uint8_t*)"abcdef", 6));
+  TEST_ASSERT_EQUAL(4, ring.pop(out, 4));
+  TEST_ASSERT_EQUAL(6, ring.push((const uint8_t*)"ghijkl", 6));   // wraps
+  TEST_ASSERT_EQUAL(8, ring.available());
+  TEST_ASSERT_FALSE(ring.push('x'));
+  TEST_ASSERT_EQUAL(1, ring.overflows());
+  TEST_ASSERT_EQUAL('e', ring.peek());
+  TEST_ASSERT_EQUAL(8, ring.pop(out, sizeof(out)));
+  TEST_ASSERT_EQUAL_STRING_LEN("efghijkl", (const char*)out, 8);
+  TEST_ASSERT_EQUAL(-1, ring.pop());
+}
+
+void test_ring_spsc_stress() {
+  static at::AtRingBuffer<256> ring;
+  const size_t total = 1 << 20;
+  std::thread producer([&]() {
+    uint8_t chunk[97];
+    size_t sent = 0;
+    size_t size = 1;
+    while (sent < total) {
+      size_t n = size < total - sent ? size : total - sent;
+      for (size_t i = 0; i < n; i++)
+        chunk[i] = (uint8_t)((sent + i) * 7);
+      size_t pushed = 0;
+      while (ring.available() + n > ring.capacity())
+        std::this_thread::yield();   // never overflow in this test
+      pushed = ring.push(chunk, n);
+      sent += pushed;
+      size = size % sizeof(chunk) + 1;
+    }
+  });
+  uint8_t buf[61];
+  size_t received = 0;
+  size_t errors = 0;
+  while (received < total) {
+    size_t n = ring.pop(buf, sizeof(buf));
+    for (size_t i = 0; i < n; i++) {
+      if (buf[i] != (uint8_t)((received + i) * 7))
+        errors++;
+    }
+    received += n;
+    if (n == 0)
+      std::this_thread::yield();
+  }
+  producer.join();
+  TEST_ASSERT_EQUAL(0, errors);
+  TEST_ASSERT_EQUAL(0, ring.overflows());
+  TEST_ASSERT_EQUAL(0, ring.available());
+}
+
+static std::atomic<int> ring_urcs{0};
+
+void test_ring_client() {
+  static at::AtRingBuffer<64> ring;
+  at_test::MemoryStream uart;
+  at::AtRingStream<64> stream(ring, uart);
+  at::AtClient modem(stream);
+  ring_urcs = 0;
+  modem.addUrcHandler("+CREG:", [](const char*, const char*) { ring_urcs++; });
+  const int count = 200;
+  std::thread receiver([&]() {
+    const char* urc = "\r\n+CREG: 1,\"00C3\",\"0A1B2C3D\",7\r\n";
+    for (int i = 0; i < count; i++) {
+      const uint8_t* p = (const uint8_t*)urc;
+      size_t len = strlen(urc);
+      while (len > 0) {
+        size_t n = ring.push(p, len < 5 ? len : 5);   // UART-sized bursts
+        p += n;
+        len -= n;
+        std::this_thread::yield();
+      }
+    }
+  });
+  auto start = std::chrono::steady_clock::now();
+  while (ring_urcs < count &&
+         std::chrono::steady_clock::now() - start < std::chrono::seconds(5)) {
+    modem.dispatchUrc();
+  }
+  receiver.join();
+  TEST_ASSERT_EQUAL(count, ring_urcs.load());
+}
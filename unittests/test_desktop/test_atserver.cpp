@@ -0,0 +1,96 @@
+#include <atserver.h>
+#include <unity.h>
+#include "memorystream.h"
+
+static std::string server_calls;
+
+static void serverRunHello() { server_calls += "hello;"; }
+static void serverRunHellox() { server_calls += "hellox;"; }
+static void serverReadHello() { server_calls += "hello?;"; }
+static at_error_t serverWriteHello(const char* params) {
+  server_calls += std::string("hello=") + params + ";";
+  return AT_OK;
+}
+
+static at_error_t serverRequest(at_test::MemoryStream& stream,
+                                at::AtServer& host, const char* request) {
+  stream.load(request);
+  at_error_t error = AT_OK;
+  while (stream.available() > 0)
+    error = host.readSerial();
+  return error;
+}
+
+void test_server_dispatch() {
+  at_test::MemoryStream stream;
+  at::AtServer host(stream);
+  at::AtCommand hellox = {"+HELLOX", nullptr, serverRunHellox, nullptr, nullptr};
+  at::AtCommand hello = {"+HELLO", serverReadHello, serverRunHello, nullptr,
+                         serverWriteHello};
+  TEST_ASSERT_TRUE(host.addCommand(&hellox));
+  TEST_ASSERT_TRUE(host.addCommand(&hello));
+  TEST_ASSERT_FALSE(host.addCommand(&hello));
+  char name[8];
+  for (int i = 0; i < 100; i++) {
+    at::AtCommand filler = {"", nullptr, serverRunHello, nullptr, nullptr};
+    snprintf(name, sizeof(name), "+F%03d", i);
+    strcpy(filler.name, name);
+    TEST_ASSERT_TRUE(host.addCommand(&filler));
+  }
+  server_calls.clear();
+  TEST_ASSERT_EQUAL(AT_OK, serverRequest(stream, host, "AT+HELLOX\r"));
+  TEST_ASSERT_EQUAL(AT_OK, serverRequest(stream, host, "AT+HELLO\r"));
+  TEST_ASSERT_EQUAL(AT_OK, serverRequest(stream, host, "AT+HELLO?\r"));
+  TEST_ASSERT_EQUAL(AT_OK, serverRequest(stream, host, "AT+HELLO=world\r"));
+  TEST_ASSERT_EQUAL_STRING("hellox;hello;hello?;hello=world;",
+                           server_calls.c_str());
+  TEST_ASSERT_EQUAL(AT_ERR_CMD_UNKNOWN,
+                    serverRequest(stream, host, "AT+HELL\r"));
+}
+
+void test_server_builtin() {
+  at_test::MemoryStream stream;
+  at::AtServer host(stream);
+  TEST_ASSERT_EQUAL(AT_OK, serverRequest(stream, host, "ATE0\r"));
+  size_t sent = stream.written().size();
+  TEST_ASSERT_EQUAL(AT_OK, serverRequest(stream, host, "AT\r"));
+  TEST_ASSERT_EQUAL_STRING("\r\nOK\r\n", stream.written().c_str() + sent);
+}
+
+static constexpr at::AtCommand server_table[] AT_FLASH = {
+  {"+ALPHA", nullptr, serverRunHellox, nullptr, nullptr},
+  {"+HELLO", serverReadHello, serverRunHello, nullptr, serverWriteHello},
+  {"+HELLOX", nullptr, serverRunHellox, nullptr, nullptr},
+};
+AT_ASSERT_COMMAND_TABLE(server_table);
+
+void test_server_command_table() {
+  at_test::MemoryStream stream;
+  at::AtServer host(stream);
+  TEST_ASSERT_TRUE(host.setCommandTable(server_table));
+  server_calls.clear();
+  TEST_ASSERT_EQUAL(AT_OK, serverRequest(stream, host, "AT+HELLOX\r"));
+  TEST_ASSERT_EQUAL(AT_OK, serverRequest(stream, host, "AT+HELLO=table\r"));
+  TEST_ASSERT_EQUAL(AT_ERR_CMD_UNKNOWN, serverRequest(stream, host, "AT+BETA\r"));
+  // runtime additions take precedence over the table
+  at::AtCommand hello = {"+HELLO", nullptr, serverRunHellox, nullptr, nullptr};
+  TEST_ASSERT_TRUE(host.addCommand(&hello));
+  TEST_ASSERT_EQUAL(AT_OK, serverRequest(stream, host, "AT+HELLO\r"));
+  TEST_ASSERT_EQUAL_STRING("hellox;hello=table;hellox;", server_calls.c_str());
+}
+
+void test_server_unsorted_table() {
+  static const at::AtCommand unsorted[] = {
+    {"+HELLO", nullptr, serverRunHello, nullptr, nullptr},
+    {"+ALPHA", nullptr, serverRunHellox, nullptr, nullptr},
+  };
+  static const at::AtCommand duplicated[] = {
+    {"+ALPHA", nullptr, serverRunHellox, nullptr, nullptr},
+    {"+ALPHA", nullptr, serverRunHellox, nullptr, nullptr},
+  };
+  at_test::MemoryStream stream;
+  at::AtServer host(stream);
+  TEST_ASSERT_FALSE(host.setCommandTable(unsorted));
+  TEST_ASSERT_FALSE(host.setCommandTable(duplicated));
+  TEST_ASSERT_EQUAL(AT_ERR_CMD_UNKNOWN, serverRequest(stream, host, "AT+ALPHA\r"));
+}
@@ -104,6 +104,25 @@ void test_replace_cstr() {
   #endif
 }
 
+void test_replace_cstr_grow() {
+  const int buffer_size = 32;
+  char cstr[buffer_size] = "a\nb\nc\n";
+  TEST_ASSERT_TRUE(at::replace(cstr, "\n", "\r\n", buffer_size));
+  TEST_ASSERT_EQUAL_STRING("a\r\nb\r\nc\r\n", cstr);
+  TEST_ASSERT_TRUE(at::replace(cstr, "\r\n", ",", buffer_size, 2));
+  TEST_ASSERT_EQUAL_STRING("a,b,c\r\n", cstr);
+  char small[8] = "aaaa";
+  TEST_ASSERT_FALSE(at::replace(small, "a", "bb", sizeof(small)));
+  TEST_ASSERT_EQUAL_STRING("aaaa", small);
+}
+
+void test_instancesOf_cstr() {
+  TEST_ASSERT_EQUAL(2, at::instancesOf("\r\nOK\r\n", "\r\n"));
+  TEST_ASSERT_EQUAL(2, at::instancesOf("aaaa", "aa"));
+  TEST_ASSERT_EQUAL(0, at::instancesOf("abc", ""));
+  TEST_ASSERT_EQUAL(3, at::instancesOf("a,b,,", ','));
+}
+
 void test_remove_cstr() {
   char test_cstr[] = "test string";
   char expected[] = "test";
@@ -168,6 +187,32 @@ void test_base64Decode() {
   #endif
 }
 
+void test_tokenizer() {
+  at::AtTokenizer tokens("1,\"IP\",\"a,b\",,\"\", 7 ");
+  at::AtSpan param;
+  TEST_ASSERT_TRUE(tokens.next(param));
+  TEST_ASSERT_TRUE(param.equals("1"));
+  TEST_ASSERT_TRUE(tokens.next(param));
+  TEST_ASSERT_TRUE(param.equals("IP"));
+  TEST_ASSERT_TRUE(tokens.next(param, false));
+  TEST_ASSERT_TRUE(param.equals("\"a,b\""));
+  TEST_ASSERT_TRUE(tokens.next(param));
+  TEST_ASSERT_TRUE(param.empty());
+  TEST_ASSERT_TRUE(tokens.next(param));
+  TEST_ASSERT_TRUE(param.empty());
+  TEST_ASSERT_TRUE(tokens.next(param));
+  TEST_ASSERT_TRUE(param.equals("7"));
+  TEST_ASSERT_TRUE(tokens.atEnd());
+  TEST_ASSERT_FALSE(tokens.next(param));
+  at::AtTokenizer trailing("0,");
+  TEST_ASSERT_TRUE(trailing.next(param));
+  TEST_ASSERT_TRUE(trailing.next(param));
+  TEST_ASSERT_TRUE(param.empty());
+  TEST_ASSERT_FALSE(trailing.next(param));
+  at::AtTokenizer none("");
+  TEST_ASSERT_FALSE(none.next(param));
+}
+
 void test_getNextParameter() {
   char test_response[32] = "param1,parameter2";
   char* p_resp = test_response;